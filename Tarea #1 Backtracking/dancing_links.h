@@ -0,0 +1,220 @@
+#ifndef DANCING_LINKS_H
+#define DANCING_LINKS_H
+
+// Algoritmo X de Knuth con Dancing Links para cualquier problema de cobertura exacta. Los enlaces
+// no son punteros sino índices en arreglos contiguos: el nodo 0 es la raíz, los nodos 1..items son
+// las cabeceras de los ítems y después vienen los nodos de cada opción (fila de la matriz), en orden.
+//
+// Los ítems primarios deben cubrirse exactamente una vez; los secundarios a lo sumo una vez. Los
+// secundarios no se enlazan a la lista de la raíz, así que nunca se eligen para ramificar, pero sus
+// columnas se cubren igual al elegir una opción que los usa.
+
+#include <vector>
+
+struct DancingLinks{
+
+    std::vector<int> left;
+    std::vector<int> right;
+    std::vector<int> up;
+    std::vector<int> down;
+    std::vector<int> item; // Cabecera del ítem de cada nodo
+    std::vector<int> option; // Opción a la que pertenece cada nodo
+    std::vector<int> length; // Nodos activos de cada ítem (indexado por cabecera)
+    std::vector<int> solution; // Opciones elegidas en la rama actual
+    int options = 0;
+    long long nodes = 0;
+
+    // Ítems 0..primary-1 primarios y primary..primary+secondary-1 secundarios. El orden de los
+    // primarios es el orden en que se revisan al buscar el de menor longitud
+
+    DancingLinks(int primary, int secondary){
+
+        int items = primary + secondary;
+
+        for (int header = 0; header <= items; header++){
+
+            bool linked = header <= primary; // La raíz y los primarios forman el anillo horizontal
+
+            left.push_back(linked ? (header == 0 ? primary : header - 1) : header);
+            right.push_back(linked ? (header == primary ? 0 : header + 1) : header);
+            up.push_back(header);
+            down.push_back(header);
+            item.push_back(header);
+            option.push_back(-1);
+            length.push_back(0);
+        }
+    }
+
+    // Agrega una opción que cubre los ítems dados (índices desde 0). Devuelve su número
+
+    int add_option(const std::vector<int>& items){
+
+        int first = left.size();
+
+        for (size_t i = 0; i < items.size(); i++){
+
+            int node = first + i;
+            int header = items[i] + 1;
+
+            left.push_back(i == 0 ? first + items.size() - 1 : node - 1);
+            right.push_back(i + 1 == items.size() ? first : node + 1);
+            up.push_back(up[header]);
+            down.push_back(header);
+            item.push_back(header);
+            option.push_back(options);
+
+            down[up[header]] = node;
+            up[header] = node;
+            length[header]++;
+        }
+
+        return options++;
+    }
+
+    void cover(int header){
+
+        right[left[header]] = right[header];
+        left[right[header]] = left[header];
+
+        for (int row = down[header]; row != header; row = down[row]){
+
+            for (int node = right[row]; node != row; node = right[node]){
+
+                down[up[node]] = down[node];
+                up[down[node]] = up[node];
+                length[item[node]]--;
+            }
+        }
+    }
+
+    // Exactamente el orden inverso de cover()
+
+    void uncover(int header){
+
+        for (int row = up[header]; row != header; row = up[row]){
+
+            for (int node = left[row]; node != row; node = left[node]){
+
+                length[item[node]]++;
+                down[up[node]] = node;
+                up[down[node]] = node;
+            }
+        }
+
+        right[left[header]] = header;
+        left[right[header]] = header;
+    }
+
+    // Búsqueda recursiva. visit(solution) se llama con cada cobertura y devuelve true para detener
+    // la búsqueda. La estructura siempre queda restaurada al volver, aunque se detenga antes
+
+    template <typename Visit>
+    bool search(Visit& visit){
+
+        if (right[0] == 0){
+
+            return visit(solution);
+
+        }
+
+        // Ítem primario con menos opciones activas
+
+        int chosen = right[0];
+
+        for (int header = right[chosen]; header != 0; header = right[header]){
+
+            if (length[header] < length[chosen]){
+
+                chosen = header;
+
+            }
+        }
+
+        if (length[chosen] == 0){
+
+            return false;
+
+        }
+
+        bool stop = false;
+        cover(chosen);
+
+        for (int row = down[chosen]; row != chosen && !stop; row = down[row]){
+
+            nodes++;
+            solution.push_back(option[row]);
+
+            for (int node = right[row]; node != row; node = right[node]){
+
+                cover(item[node]);
+
+            }
+
+            stop = search(visit);
+
+            for (int node = left[row]; node != row; node = left[node]){
+
+                uncover(item[node]);
+
+            }
+
+            solution.pop_back();
+        }
+
+        uncover(chosen);
+
+        return stop;
+    }
+
+    // Modos de uso: primera solución, conteo y recorrido de todas las soluciones
+
+    bool first(std::vector<int>& chosen){
+
+        bool found = false;
+        auto visit = [&chosen, &found](const std::vector<int>& current){
+
+            chosen = current;
+            found = true;
+            return true;
+        };
+
+        nodes = 0;
+        search(visit);
+
+        return found;
+    }
+
+    long long count(){
+
+        long long total = 0;
+        auto visit = [&total](const std::vector<int>&){
+
+            total++;
+            return false;
+        };
+
+        nodes = 0;
+        search(visit);
+
+        return total;
+    }
+
+    template <typename Visit>
+    long long enumerate(Visit on_solution){
+
+        long long total = 0;
+        auto visit = [&total, &on_solution](const std::vector<int>& current){
+
+            total++;
+            on_solution(current);
+            return false;
+        };
+
+        nodes = 0;
+        search(visit);
+
+        return total;
+    }
+};
+
+#endif
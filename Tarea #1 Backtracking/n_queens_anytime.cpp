@@ -0,0 +1,75 @@
+#include <iostream>
+#include <chrono>
+#include <atomic>
+#include <thread>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "n_queens_anytime.h"
+#include "n_queens_verify.h"
+using namespace std;
+using namespace std::chrono;
+
+int main(){
+
+    // Sin límites efectivos: resuelve o demuestra que no hay solución
+
+    int solved = 0;
+
+    for (int n = 4; n <= 27; n++){
+
+        SolveReport report = solve_anytime(n, deadline_after(10000000));
+
+        if (report.status == SOLVED && valid_solution(report.queens)) solved++;
+
+    }
+
+    cout << "N = 4..27 with a 10 s deadline: " << solved << " of 24 solved" << endl;
+    cout << "N = 2: " << STATUS_NAMES[solve_anytime(2, SolveLimits()).status] << ", N = 3: " << STATUS_NAMES[solve_anytime(3, SolveLimits()).status] << endl;
+
+    // Plazos cortos sobre un tablero cuya primera solución lexicográfica tarda horas
+
+    const int HARD_N = 48;
+
+    for (long long budget : {100LL, 1000LL, 10000LL, 100000LL}){
+
+        SolveReport report = solve_anytime(HARD_N, deadline_after(budget));
+
+        cout << "N = " << HARD_N << ", deadline " << budget << " microseconds: " << STATUS_NAMES[report.status] << " after "
+             << report.microseconds << " microseconds (overrun " << report.microseconds - budget << "), " << report.nodes
+             << " nodes, deepest row " << report.best_depth << endl;
+    }
+
+    // Presupuesto de nodos
+
+    SolveLimits node_limits;
+    node_limits.node_budget = 1000000;
+    SolveReport budget_report = solve_anytime(HARD_N, node_limits);
+
+    cout << "N = " << HARD_N << ", node budget " << node_limits.node_budget << ": " << STATUS_NAMES[budget_report.status] << " after "
+         << budget_report.nodes << " nodes" << endl;
+
+    // Cancelación desde otro hilo
+
+    CancellationToken token;
+    SolveLimits cancellable;
+    cancellable.token = &token;
+    SolveReport cancelled_report;
+
+    thread solver_thread([&cancelled_report, &cancellable](){
+
+        cancelled_report = solve_anytime(HARD_N, cancellable);
+
+    });
+
+    this_thread::sleep_for(milliseconds(20));
+    auto cancel_time = steady_clock::now();
+    token.cancel();
+    solver_thread.join();
+    auto latency = duration_cast<microseconds>(steady_clock::now() - cancel_time).count();
+
+    cout << "N = " << HARD_N << ", cancelled after 20 ms: " << STATUS_NAMES[cancelled_report.status] << ", returned "
+         << latency << " microseconds after cancel(), " << cancelled_report.nodes << " nodes" << endl;
+
+    return 0;
+}
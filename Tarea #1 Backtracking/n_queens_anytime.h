@@ -0,0 +1,200 @@
+#ifndef N_QUEENS_ANYTIME_H
+#define N_QUEENS_ANYTIME_H
+
+// Búsqueda con plazo, presupuesto de nodos y cancelación de n_queens_anytime.cpp, para tableros de
+// hasta MAX_MASK_SIZE columnas. La usan n_queens_anytime.cpp y n_queens_benchmark.cpp
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <vector>
+#include "n_queens_row.h"
+
+const long long CHECK_INTERVAL = 4096; // Nodos entre revisiones del reloj y del token (potencia de 2)
+
+// Resultado de una búsqueda con límites
+
+enum SolveStatus{ SOLVED, INFEASIBLE, TIMED_OUT, CANCELLED, BUDGET_EXHAUSTED };
+
+const char* const STATUS_NAMES[] = {"solved", "infeasible", "timed out", "cancelled", "node budget exhausted"};
+
+// Token de cancelación: otro hilo llama a cancel() y la búsqueda lo ve en la siguiente revisión
+
+struct CancellationToken{
+
+    std::atomic<bool> cancelled{false};
+
+    void cancel(){ cancelled.store(true, std::memory_order_relaxed); }
+    bool is_cancelled() const{ return cancelled.load(std::memory_order_relaxed); }
+
+};
+
+struct SolveLimits{
+
+    long long node_budget = -1; // -1 sin límite de nodos
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+    const CancellationToken* token = nullptr;
+
+};
+
+// Progreso de la búsqueda: además de la solución se devuelve la colocación parcial más profunda
+// alcanzada, que sirve como respuesta aproximada cuando se acaba el tiempo
+
+struct SolveReport{
+
+    SolveStatus status = INFEASIBLE;
+    std::vector<int> queens; // queens[fila] = columna, solo si status == SOLVED
+    std::vector<int> best_partial; // Reinas de las filas 0..best_depth-1 de la rama más profunda
+    int best_depth = 0;
+    long long nodes = 0;
+    long long microseconds = 0;
+
+};
+
+// Motor de máscaras de bits de n_queens_row_opt.cpp (misma primera solución que backtracking())
+// con revisiones de límites. Entre revisiones solo se compara un contador, así que el costo por
+// nodo es el mismo que sin límites; el tiempo extra después de vencido el plazo es a lo sumo el de
+// CHECK_INTERVAL nodos
+
+struct AnytimeSolver{
+
+    int n;
+    mask_t full;
+    SolveLimits limits;
+    int queens[MAX_MASK_SIZE];
+    int best_partial[MAX_MASK_SIZE];
+    int best_depth = 0;
+    long long nodes = 0;
+    long long next_check = CHECK_INTERVAL;
+    bool stopped = false;
+    SolveStatus stop_reason = TIMED_OUT;
+
+    AnytimeSolver(int size, const SolveLimits& solve_limits) : n(size), full(size == 64 ? ~0ULL : ((1ULL << size) - 1)), limits(solve_limits){}
+
+    void check_limits(){
+
+        if (limits.token && limits.token->is_cancelled()){
+
+            stopped = true;
+            stop_reason = CANCELLED;
+
+        } else if (limits.node_budget >= 0 && nodes >= limits.node_budget){
+
+            stopped = true;
+            stop_reason = BUDGET_EXHAUSTED;
+
+        } else if (std::chrono::steady_clock::now() >= limits.deadline){
+
+            stopped = true;
+            stop_reason = TIMED_OUT;
+
+        }
+
+        next_check = nodes + CHECK_INTERVAL;
+
+        if (limits.node_budget >= 0){
+
+            next_check = std::min(next_check, limits.node_budget);
+
+        }
+    }
+
+    // Devuelve true si encontró una solución o si hay que detenerse
+
+    bool search(int row, mask_t columns, mask_t diagonals, mask_t anti_diagonals){
+
+        if (row > best_depth){
+
+            best_depth = row;
+            std::copy(queens, queens + row, best_partial);
+
+        }
+
+        if (row == n){
+
+            return true;
+
+        }
+
+        mask_t free_columns = ~(columns | diagonals | anti_diagonals) & full;
+
+        while (free_columns){
+
+            if (nodes == next_check){
+
+                check_limits();
+
+                if (stopped){
+
+                    return true;
+
+                }
+            }
+
+            nodes++;
+
+            mask_t bit = free_columns & (~free_columns + 1);
+            queens[row] = __builtin_ctzll(bit);
+
+            if (search(row + 1, columns | bit, ((diagonals | bit) << 1) & full, (anti_diagonals | bit) >> 1)){
+
+                return true;
+
+            }
+
+            free_columns &= free_columns - 1;
+        }
+
+        return false;
+    }
+};
+
+inline SolveReport solve_anytime(int n, const SolveLimits& limits){
+
+    SolveReport report;
+
+    if (n < 1 || n > MAX_MASK_SIZE){
+
+        return report;
+
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    AnytimeSolver solver(n, limits);
+
+    solver.check_limits(); // Un plazo ya vencido o un token ya cancelado se respetan sin buscar
+
+    bool finished = !solver.stopped && solver.search(0, 0, 0, 0);
+
+    if (solver.stopped){
+
+        report.status = solver.stop_reason;
+
+    } else{
+
+        report.status = finished ? SOLVED : INFEASIBLE;
+
+    }
+
+    if (report.status == SOLVED){
+
+        report.queens.assign(solver.queens, solver.queens + n);
+
+    }
+
+    report.best_depth = solver.best_depth;
+    report.best_partial.assign(solver.best_partial, solver.best_partial + solver.best_depth);
+    report.nodes = solver.nodes;
+    report.microseconds = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    return report;
+}
+
+inline SolveLimits deadline_after(long long budget_microseconds){
+
+    SolveLimits limits;
+    limits.deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(budget_microseconds);
+    return limits;
+}
+
+#endif
@@ -0,0 +1,175 @@
+#ifndef N_QUEENS_ARRAY_H
+#define N_QUEENS_ARRAY_H
+
+// Motores de n_queens_array_opt.cpp: permute() sobre una permutación de columnas y la construcción
+// explícita en O(N). En los dos A[i] es la columna de la reina de la fila i. Los usan
+// n_queens_array_opt.cpp y n_queens_benchmark.cpp
+
+#include <cstdlib>
+#include <utility>
+#include <vector>
+#include "n_queens_stats.h"
+
+// Backtracking sobre permutaciones: cada fila toma una columna todavía no usada, así que solo hay
+// que revisar las diagonales contra las filas anteriores. Todo el estado vive en el objeto
+
+struct PermuteSolver{
+
+    int n;
+    std::vector<int> A;
+    bool solution_found = false;
+    long long nodes = 0; // Reinas colocadas
+    SearchStats stats; // Vacío salvo que se compile con -DNQ_STATS; check() cuenta llamadas a sameDiagonal()
+
+    PermuteSolver(int size) : n(size), A(size){
+
+        reset();
+        stats.reset(size);
+    }
+
+    static bool sameDiagonal(int col1, int row1, int col2, int row2){
+
+        return std::abs(col1 - col2) == std::abs(row1 - row2);
+
+    }
+
+    /* void printSolution(){
+
+        for (int i = 0; i < n; i++){
+
+            for (int j = 0; j < n; j++){
+
+                if (A[j] == i){
+
+                    std::cout << "Q ";
+
+                } else{
+
+                    std::cout << ". ";
+
+                }
+            }
+
+            std::cout << std::endl;
+        }
+    } */
+
+    void permute(int step){
+
+        if (solution_found){
+
+            return;
+
+        }
+
+        stats.node(step);
+
+        if (step == n){
+
+            // printSolution();
+            solution_found = true;
+            return;
+
+        }
+
+        bool placed = false;
+
+        for (int i = step; i < n; i++){
+
+            bool valid = true;
+
+            for (int k = 0; k < step; k++){
+
+                stats.check();
+
+                if (sameDiagonal(k, A[k], step, A[i])){
+
+                    valid = false;
+                    break;
+
+                }
+
+            }
+
+            if (valid){
+
+                placed = true;
+                nodes++;
+                stats.branch(step);
+
+                std::swap(A[step], A[i]); // Intercambia de lugar el elemento actual con el de la posición i
+                permute(step + 1); // Llama a la función recursiva para la siguiente posición
+                stats.backtrack(step);
+                std::swap(A[step], A[i]); // Backtracking
+
+            }
+        }
+
+        if (!placed){
+
+            stats.dead_end(step);
+
+        }
+    }
+
+    // Vuelve a la permutación identidad. Los contadores de stats se acumulan entre llamadas
+
+    void reset(){
+
+        solution_found = false;
+        nodes = 0;
+
+        for (int i = 0; i < n; i++) {
+            A[i] = i;
+        }
+    }
+};
+
+// Construcción explícita de una solución en O(N) para N = 1 y todo N >= 4: primero las columnas
+// pares y luego las impares (en base 1), con los ajustes conocidos cuando N mod 6 es 2 o 3. Para
+// N = 2 y N = 3 no existe solución: devuelve false y no toca A
+
+inline bool constructive(int A[], int n){
+
+    if (n < 1 || n == 2 || n == 3){
+
+        return false;
+
+    }
+
+    int index = 0;
+
+    if (n % 6 == 3){
+
+        // Pares 4, 6, ..., 2 e impares 5, 7, ..., 1, 3
+
+        for (int column = 4; column <= n; column += 2) A[index++] = column - 1;
+        A[index++] = 2 - 1;
+        for (int column = 5; column <= n; column += 2) A[index++] = column - 1;
+        A[index++] = 1 - 1;
+        A[index++] = 3 - 1;
+
+    } else{
+
+        for (int column = 2; column <= n; column += 2) A[index++] = column - 1;
+
+        if (n % 6 == 2){
+
+            // Impares 3, 1, 7, 9, ..., 5
+
+            A[index++] = 3 - 1;
+            A[index++] = 1 - 1;
+            for (int column = 7; column <= n; column += 2) A[index++] = column - 1;
+            A[index++] = 5 - 1;
+
+        } else{
+
+            for (int column = 1; column <= n; column += 2) A[index++] = column - 1;
+
+        }
+    }
+
+    return true;
+}
+
+#endif
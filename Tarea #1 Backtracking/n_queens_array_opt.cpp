@@ -1,102 +1,54 @@
 #include <iostream>
 #include <chrono>
+#include <vector>
+#include "n_queens_array.h"
 using namespace std;
 using namespace std::chrono;
 
-bool solution_found = false;
+// Verifica en O(N) que A sea una solución: cada columna y cada diagonal se usa a lo sumo una vez
 
-bool sameDiagonal(int col1, int row1, int col2, int row2){
+bool verify(const int A[], int n){
 
-    return abs(col1 - col2) == abs(row1 - row2);
+    vector<bool> columns(n, false);
+    vector<bool> diagonals(2 * n - 1, false);
+    vector<bool> anti_diagonals(2 * n - 1, false);
 
-}
-
-/* void printSolution(int A[], int n){
-
-    for (int i = 0; i < n; i++){
+    for (int row = 0; row < n; row++){
 
-        for (int j = 0; j < n; j++){
+        int column = A[row];
 
-            if (A[j] == i){
+        if (column < 0 || column >= n || columns[column] || diagonals[row + column] || anti_diagonals[row - column + n - 1]){
 
-                cout << "Q ";
+            return false;
 
-            } else{
-
-                cout << ". ";
-
-            }
         }
 
-        cout << endl;
-    }
-} */
-
-void permute(int step, int A[], int n){
-
-    if (solution_found){
-
-        return;
-
-    }
-
-    if (step == n){
-
-        // printSolution(A, n);
-        solution_found = true;
-        return;
-
+        columns[column] = true;
+        diagonals[row + column] = true;
+        anti_diagonals[row - column + n - 1] = true;
     }
 
-    for (int i = step; i < n; i++){
-
-        bool valid = true;
-
-        for (int k = 0; k < step; k++){
-
-            if (sameDiagonal(k, A[k], step, A[i])){
-
-                valid = false;
-                break;
-
-            }
-
-        }
-
-        if (valid){
-
-            swap(A[step], A[i]); // Intercambia de lugar el elemento actual con el de la posición i
-            permute(step + 1, A, n); // Llama a la función recursiva para la siguiente posición
-            swap(A[step], A[i]); // Backtracking
-
-        }
-    }
-}
-
-void reset(int queens[], int n){
-
-    solution_found = false;
-    for (int i = 0; i < n; i++) {
-        queens[i] = i;
-    }
+    return true;
 }
 
 int main(){
 
     const int n = 32; 
     const int ITERATIONS = 50; 
-    int queens[n];
+    PermuteSolver solver(n);
     long long total_duration = 0;
     long long total_microseconds = 0;
     double total_milliseconds = 0.0;
 
     for (int run = 0; run < ITERATIONS; run++){
 
-        reset(queens, n);
+        solver.reset();
         
+        SearchStats::timestamp solve_start = solver.stats.start_timer();
         auto start = high_resolution_clock::now();
-        permute(0, queens, n);
+        solver.permute(0);
         auto stop = high_resolution_clock::now();
+        solver.stats.stop_solve(solve_start);
         
         auto duration = duration_cast<microseconds>(stop - start);
         total_microseconds += duration.count();
@@ -111,5 +63,43 @@ int main(){
     cout << "Total execution time for " << ITERATIONS << " iterations: " << total_duration << " microseconds" << endl;
     cout << "Average execution time: " << avg_microseconds << " microseconds (" << avg_milliseconds << " milliseconds)" << endl;
 
+    // Contadores acumulados de todas las iteraciones (solo con -DNQ_STATS)
+
+    solver.stats.report("permute, " + to_string(ITERATIONS) + " runs");
+
+    if (solver.stats.export_csv("n_queens_array_opt_stats.csv")){
+
+        cout << "Per-row histogram written to n_queens_array_opt_stats.csv" << endl;
+
+    }
+
+    // Modo constructivo: se comprueba para todos los N pequeños y se mide con un tablero enorme
+
+    const int MAX_CHECKED_N = 2000;
+    const int LARGE_N = 10000000;
+    vector<int> large_queens(LARGE_N);
+    int failures = 0;
+
+    for (int size = 1; size <= MAX_CHECKED_N; size++){
+
+        bool built = constructive(large_queens.data(), size);
+
+        if (built != (size != 2 && size != 3) || (built && !verify(large_queens.data(), size))){
+
+            failures++;
+
+        }
+    }
+
+    auto start = high_resolution_clock::now();
+    constructive(large_queens.data(), LARGE_N);
+    auto stop = high_resolution_clock::now();
+    bool valid = verify(large_queens.data(), LARGE_N);
+    auto verified = high_resolution_clock::now();
+
+    cout << "Constructive solutions checked for N = 1.." << MAX_CHECKED_N << ": " << failures << " failures" << endl;
+    cout << "Constructive N = " << LARGE_N << ": " << duration_cast<microseconds>(stop - start).count() << " microseconds, verification "
+         << duration_cast<microseconds>(verified - stop).count() << " microseconds (" << (valid ? "valid" : "INVALID") << ")" << endl;
+
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,310 @@
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+#include "n_queens_array.h"
+#include "n_queens_row.h"
+#include "n_queens_probabilistic.h"
+#include "n_queens_dlx.h"
+#include "n_queens_bitset.h"
+#include "n_queens_template.h"
+#include "n_queens_count.h"
+#include "n_queens_mrv.h"
+#include "n_queens_anytime.h"
+#include "n_queens_table.h"
+#include "n_queens_completion.h"
+#include "n_queens_simd.h"
+#include "n_queens_verify.h"
+using namespace std;
+using namespace std::chrono;
+
+// Banco de pruebas de todas las estrategias de N reinas. Cada motor se incluye del mismo encabezado
+// que usa su programa (n_queens_array.h, n_queens_row.h, n_queens_probabilistic.h, n_queens_dlx.h,
+// n_queens_bitset.h, n_queens_template.h, n_queens_count.h, n_queens_mrv.h, n_queens_anytime.h,
+// n_queens_table.h, n_queens_completion.h y n_queens_simd.h), así que se mide exactamente el código
+// actual. Los resultados se imprimen y se guardan en CSV para comparar versiones. Compilar con
+// -pthread por el conteo paralelo y la carrera de hilos. Quedan fuera los programas de conteo con
+// archivos (stream, checkpoint y distribuido), cuyo motor es count_solutions() o parallel_count(), y
+// la caché de transposición de n_queens_count.cpp, que solo existe compilando con -mbmi2
+
+const int WARMUP_RUNS = 2;
+const int MAX_SAMPLES = 51;
+const double TIME_BUDGET_SECONDS = 2.0; // Tiempo máximo de muestreo por motor y tamaño
+const string CSV_PATH = "n_queens_benchmark.csv";
+
+// Un motor resuelve un tablero de tamaño n con la semilla dada y suma los nodos visitados. Los
+// motores sin contador de nodos (plantilla, conteo paralelo, tabla, probabilístico adaptativo y
+// carrera de hilos) no suman nada y su tasa queda vacía
+
+struct Engine{
+
+    string name;
+    int min_n;
+    int max_n; // Tamaños mayores tardan demasiado para muestrear
+    function<bool(int n, unsigned seed, long long& nodes)> run;
+
+};
+
+struct Summary{
+
+    int samples = 0;
+    int solved = 0;
+    long long median = 0;
+    long long p90 = 0;
+    long long p99 = 0;
+    double nodes_per_second = 0;
+
+};
+
+long long percentile(const vector<long long>& sorted, int p){
+
+    size_t rank = (sorted.size() * p + 99) / 100; // Rango más cercano
+    return sorted[max<size_t>(rank, 1) - 1];
+}
+
+Summary measure(const Engine& engine, int n, mt19937& seeds){
+
+    long long nodes = 0;
+
+    for (int i = 0; i < WARMUP_RUNS; i++){
+
+        engine.run(n, seeds(), nodes);
+
+    }
+
+    Summary summary;
+    vector<long long> samples;
+    long long total_nodes = 0;
+    long long total_nanoseconds = 0;
+
+    while (static_cast<int>(samples.size()) < MAX_SAMPLES && total_nanoseconds < TIME_BUDGET_SECONDS * 1e9){
+
+        nodes = 0;
+        unsigned seed = seeds();
+
+        auto start = high_resolution_clock::now();
+        bool solved = engine.run(n, seed, nodes);
+        auto stop = high_resolution_clock::now();
+        long long elapsed = duration_cast<nanoseconds>(stop - start).count();
+
+        samples.push_back(elapsed);
+        total_nanoseconds += elapsed;
+        total_nodes += nodes;
+
+        if (solved) summary.solved++;
+    }
+
+    sort(samples.begin(), samples.end());
+
+    summary.samples = samples.size();
+    summary.median = percentile(samples, 50);
+    summary.p90 = percentile(samples, 90);
+    summary.p99 = percentile(samples, 99);
+    summary.nodes_per_second = total_nanoseconds > 0 ? total_nodes / (total_nanoseconds / 1e9) : 0;
+
+    return summary;
+}
+
+int main(){
+
+    const int SIZES[] = {8, 12, 16, 20, 24, 28, 32, 64, 1000, 100000};
+    int threads = max(1u, thread::hardware_concurrency());
+
+    vector<Engine> engines = {
+        {"permute", 4, 24, [](int n, unsigned, long long& nodes){
+
+            PermuteSolver solver(n);
+            solver.permute(0);
+            nodes += solver.nodes;
+            return solver.solution_found;
+        }},
+        {"backtracking", 4, 24, [](int n, unsigned, long long& nodes){
+
+            RowSolver solver(n);
+            solver.backtracking(0, 1);
+            nodes += solver.nodes;
+            return solver.solution_found;
+        }},
+        {"probabilistic_backtracking", 4, 20, [](int n, unsigned seed, long long& nodes){
+
+            ProbabilisticSolver<> solver(n, seed);
+            solver.probabilistic_backtracking(0, 1);
+            nodes += solver.nodes;
+            return solver.solution_found;
+        }},
+        {"bitmask", 4, 32, [](int n, unsigned, long long& nodes){
+
+            BitmaskSolver solver(n);
+            solver.bitmask_backtracking(0, 0, 0, 0);
+            nodes += solver.nodes;
+            return solver.solution_found;
+        }},
+        {"bitset", 4, 32, [](int n, unsigned, long long& nodes){
+
+            BitsetSolver solver(n);
+            bool solved = solver.solve();
+            nodes += solver.nodes;
+            return solved;
+        }},
+        {"template", 4, 32, [](int n, unsigned, long long&){
+
+            vector<int> queens(n);
+            return solve_specialized(n, queens.data());
+        }},
+        {"parallel_count", 4, 12, [threads](int n, unsigned, long long&){
+
+            return n < KNOWN_SOLUTIONS_SIZE && parallel_count(n, threads) == KNOWN_SOLUTIONS[n];
+
+        }},
+        {"forward_checking", 4, 32, [](int n, unsigned, long long& nodes){
+
+            BitmaskSolver solver(n);
+            solver.bitmask_backtracking<true>(0, 0, 0, 0);
+            nodes += solver.nodes;
+            return solver.solution_found;
+        }},
+        {"mrv", 4, 64, [](int n, unsigned, long long& nodes){
+
+            MrvSolver solver(n);
+            bool solved = solver.solve();
+            nodes += solver.nodes;
+            return solved;
+        }},
+        {"fewest_free_cells", 4, 64, [](int n, unsigned, long long& nodes){
+
+            FewestFreeCellsSolver solver(n);
+            bool solved = solver.solve();
+            nodes += solver.nodes;
+            return solved;
+        }},
+        {"anytime", 4, 32, [](int n, unsigned, long long& nodes){
+
+            SolveReport report = solve_anytime(n, SolveLimits());
+            nodes += report.nodes;
+            return report.status == SOLVED;
+        }},
+        {"table", 1, 27, [](int n, unsigned, long long&){
+
+            vector<int> queens;
+            return first_solution(n, queens);
+
+        }},
+        {"completion", 8, 64, [](int n, unsigned seed, long long& nodes){
+
+            mt19937 rng(seed);
+            CompletionResult result = complete(n, random_placement(n, 1, rng));
+            nodes += result.nodes;
+            return result.status == COMPLETED;
+        }},
+        {"simd_lanes", 4, MAX_SMALL_N, [](int n, unsigned seed, long long& nodes){
+
+            // Un lote de LANES tableros, cada uno con una reina fija al azar
+
+            mt19937 rng(seed);
+            vector<SmallInstance> instances(LANES);
+
+            for (SmallInstance& instance : instances){
+
+                instance.n = n;
+                instance.fixed = random_placement(n, 1, rng);
+
+            }
+
+            long long steps = 0;
+            bool solved = true;
+
+            for (const SmallResult& result : solve_lanes(instances, &steps)){
+
+                solved = solved && result.status == COMPLETED && valid_solution(result.queens);
+
+            }
+
+            nodes += steps;
+            return solved;
+        }},
+        {"adaptive_probabilistic", 4, 64, [](int n, unsigned seed, long long&){
+
+            ProbabilisticSolver<> solver(n, seed);
+            solver.adaptive_solve();
+            return solver.solution_found;
+        }},
+        {"parallel_racing", 4, 64, [threads](int n, unsigned seed, long long&){
+
+            vector<int> queens;
+            parallel_racing(n, threads, seed, queens);
+            return valid_solution(queens);
+        }},
+        {"dlx", 4, 64, [](int n, unsigned, long long& nodes){
+
+            DancingLinks links = build_n_queens(n);
+            vector<int> options;
+            bool solved = links.first(options);
+            nodes += links.nodes;
+            return solved;
+        }},
+        {"min_conflicts", 4, 100000, [](int n, unsigned seed, long long& nodes){
+
+            MinConflictsSolver solver(n, seed);
+            bool solved = solver.solve();
+            nodes += solver.iterations;
+            return solved;
+        }},
+        {"constructive", 4, 100000, [](int n, unsigned, long long& nodes){
+
+            vector<int> queens(n);
+            nodes += n;
+            return constructive(queens.data(), n);
+        }},
+    };
+
+    ofstream csv(CSV_PATH);
+    csv << "engine,n,samples,success_rate,median_ns,p90_ns,p99_ns,nodes_per_second" << endl;
+
+    mt19937 seeds(123456789); // Semilla fija para que las corridas sean comparables entre versiones
+
+    for (const Engine& engine : engines){
+
+        for (int n : SIZES){
+
+            if (n < engine.min_n || n > engine.max_n){
+
+                continue;
+
+            }
+
+            Summary summary = measure(engine, n, seeds);
+            double success_rate = 100.0 * summary.solved / summary.samples;
+
+            cout << engine.name << " N = " << n << ": median " << summary.median << " ns, p90 " << summary.p90 << " ns, p99 "
+                 << summary.p99 << " ns, ";
+
+            if (summary.nodes_per_second > 0){
+
+                cout << summary.nodes_per_second << " nodes/second, ";
+
+            }
+
+            cout << success_rate << "% solved (" << summary.samples << " samples)" << endl;
+
+            csv << engine.name << "," << n << "," << summary.samples << "," << success_rate << "," << summary.median << ","
+                << summary.p90 << "," << summary.p99 << ",";
+
+            if (summary.nodes_per_second > 0){
+
+                csv << summary.nodes_per_second;
+
+            }
+
+            csv << endl;
+        }
+    }
+
+    cout << "Results written to " << CSV_PATH << endl;
+
+    return 0;
+}
@@ -0,0 +1,58 @@
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include "n_queens_bitset.h"
+#include "n_queens_row.h"
+#include "n_queens_verify.h"
+using namespace std;
+using namespace std::chrono;
+
+int main(){
+
+    cout << "Backend: " << BITSET_BACKEND << endl;
+
+    // Misma primera solución que el motor de 64 bits
+
+    const int MAX_CHECKED_N = 27;
+    bool same_solutions = true;
+
+    for (int n = 4; n <= MAX_CHECKED_N; n++){
+
+        BitsetSolver bitset(n);
+        BitmaskSolver bitmask(n);
+
+        bitset.solve();
+        bitmask.bitmask_backtracking(0, 0, 0, 0);
+
+        if (bitset.queens != bitmask.queen_column){
+
+            same_solutions = false;
+
+        }
+    }
+
+    cout << "Same first solutions as the 64-bit engine for N = 4.." << MAX_CHECKED_N << ": " << (same_solutions ? "yes" : "no") << endl;
+
+    // Tableros grandes. La primera solución en orden lexicográfico puede requerir un árbol enorme
+    // para algunos N, así que cada búsqueda tiene un presupuesto de nodos; los nodos por segundo
+    // muestran el costo de colocar una reina según N. Todas las versiones recorren el mismo árbol,
+    // así que para comparar backends basta compilar con -mavx2, sin flags y con -DBITSET_SCALAR
+
+    const long long NODE_BUDGET = 5000000;
+    const int LARGE_SIZES[] = {64, 128, 192, 256, 384, 512, 768, 1024};
+
+    for (int n : LARGE_SIZES){
+
+        BitsetSolver solver(n);
+
+        auto start = high_resolution_clock::now();
+        bool solved = solver.solve(NODE_BUDGET);
+        auto stop = high_resolution_clock::now();
+        double seconds = duration_cast<nanoseconds>(stop - start).count() / 1e9;
+
+        cout << "N = " << n << ": " << (solved ? (valid_solution(solver.queens) ? "solved" : "INVALID") : "node budget exhausted") << ", "
+             << solver.nodes << " nodes in " << seconds * 1e6 << " microseconds (" << solver.nodes / seconds << " nodes/second)" << endl;
+    }
+
+    return 0;
+}
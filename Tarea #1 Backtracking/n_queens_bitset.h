@@ -0,0 +1,256 @@
+#ifndef N_QUEENS_BITSET_H
+#define N_QUEENS_BITSET_H
+
+// Motor por filas con conjuntos de bits de varias palabras (n_queens_bitset.cpp), para tableros de
+// hasta MAX_BITSET_SIZE columnas. Lo usan n_queens_bitset.cpp, n_queens_mrv.cpp y n_queens_benchmark.cpp
+//
+// Compilar con -mavx2 (o -march=native) para usar AVX2. Sin eso se usa SSE2 si está disponible y,
+// si no, la versión escalar. -DBITSET_SCALAR fuerza la versión escalar para comparar
+
+#include <cstdint>
+#include <vector>
+
+#if defined(__AVX2__) && !defined(BITSET_SCALAR)
+#include <immintrin.h>
+#define BITSET_AVX2
+const char* const BITSET_BACKEND = "AVX2";
+#elif defined(__SSE2__) && !defined(BITSET_SCALAR)
+#include <emmintrin.h>
+#define BITSET_SSE2
+const char* const BITSET_BACKEND = "SSE2";
+#else
+const char* const BITSET_BACKEND = "scalar";
+#endif
+
+const int MAX_BITSET_SIZE = 1024;
+const int CHUNK_WORDS = 4; // Las operaciones avanzan en bloques de 256 bits
+const int MAX_BITSET_WORDS = MAX_BITSET_SIZE / 64;
+const int BITSET_PAD = CHUNK_WORDS; // Palabras en cero antes y después de los datos
+
+// Conjunto de bits de hasta MAX_BITSET_SIZE columnas. El bit i está en la palabra BITSET_PAD + i / 64:
+// las palabras de relleno a cada lado siempre valen cero, así que un desplazamiento lee la palabra
+// vecina con una carga desalineada sin casos especiales en los bordes. Solo se usan los primeros
+// chunks bloques de 256 bits, así que el costo depende de N y no de MAX_BITSET_SIZE
+
+struct alignas(32) Bitset{
+
+    uint64_t words[MAX_BITSET_WORDS + 2 * BITSET_PAD];
+
+};
+
+// out = valid & ~(a | b | c)
+
+inline void free_columns(const Bitset& a, const Bitset& b, const Bitset& c, const Bitset& valid, Bitset& out, int chunks){
+
+    int end = BITSET_PAD + chunks * CHUNK_WORDS;
+
+#if defined(BITSET_AVX2)
+    for (int i = BITSET_PAD; i < end; i += 4){
+
+        __m256i occupied = _mm256_or_si256(_mm256_load_si256(reinterpret_cast<const __m256i*>(a.words + i)),
+                           _mm256_or_si256(_mm256_load_si256(reinterpret_cast<const __m256i*>(b.words + i)),
+                                           _mm256_load_si256(reinterpret_cast<const __m256i*>(c.words + i))));
+        __m256i result = _mm256_andnot_si256(occupied, _mm256_load_si256(reinterpret_cast<const __m256i*>(valid.words + i)));
+        _mm256_store_si256(reinterpret_cast<__m256i*>(out.words + i), result);
+    }
+#elif defined(BITSET_SSE2)
+    for (int i = BITSET_PAD; i < end; i += 2){
+
+        __m128i occupied = _mm_or_si128(_mm_load_si128(reinterpret_cast<const __m128i*>(a.words + i)),
+                           _mm_or_si128(_mm_load_si128(reinterpret_cast<const __m128i*>(b.words + i)),
+                                        _mm_load_si128(reinterpret_cast<const __m128i*>(c.words + i))));
+        __m128i result = _mm_andnot_si128(occupied, _mm_load_si128(reinterpret_cast<const __m128i*>(valid.words + i)));
+        _mm_store_si128(reinterpret_cast<__m128i*>(out.words + i), result);
+    }
+#else
+    for (int i = BITSET_PAD; i < end; i++){
+
+        out.words[i] = valid.words[i] & ~(a.words[i] | b.words[i] | c.words[i]);
+
+    }
+#endif
+}
+
+// Primer bit encendido en una posición >= from, o -1 si no hay
+
+inline int next_set_bit(const Bitset& bits, int from, int chunks){
+
+    int words = chunks * CHUNK_WORDS;
+    int word = from >> 6;
+
+    if (word >= words){
+
+        return -1;
+
+    }
+
+    uint64_t current = bits.words[BITSET_PAD + word] & (~0ULL << (from & 63));
+
+    while (!current){
+
+        if (++word >= words){
+
+            return -1;
+
+        }
+
+        current = bits.words[BITSET_PAD + word];
+    }
+
+    return (word << 6) + __builtin_ctzll(current);
+}
+
+// Ocupación vista desde una fila: columnas, diagonales descendentes y diagonales ascendentes
+
+struct Frame{
+
+    Bitset columns;
+    Bitset diagonals;
+    Bitset anti_diagonals;
+
+};
+
+// Construye la ocupación de la fila siguiente en una sola pasada: copia las columnas, desplaza las
+// diagonales descendentes un bit hacia las columnas mayores (descartando la que sale del tablero)
+// y las ascendentes un bit hacia las menores. El acarreo entre palabras es la palabra vecina
+// desplazada 63 bits, leída desde el relleno en los bordes
+
+inline void advance_frame(const Frame& current, Frame& next, const Bitset& valid, int chunks){
+
+    int end = BITSET_PAD + chunks * CHUNK_WORDS;
+
+#if defined(BITSET_AVX2)
+    for (int i = BITSET_PAD; i < end; i += 4){
+
+        __m256i diagonals = _mm256_or_si256(_mm256_slli_epi64(_mm256_load_si256(reinterpret_cast<const __m256i*>(current.diagonals.words + i)), 1),
+                                            _mm256_srli_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(current.diagonals.words + i - 1)), 63));
+        __m256i anti_diagonals = _mm256_or_si256(_mm256_srli_epi64(_mm256_load_si256(reinterpret_cast<const __m256i*>(current.anti_diagonals.words + i)), 1),
+                                                 _mm256_slli_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(current.anti_diagonals.words + i + 1)), 63));
+
+        _mm256_store_si256(reinterpret_cast<__m256i*>(next.columns.words + i), _mm256_load_si256(reinterpret_cast<const __m256i*>(current.columns.words + i)));
+        _mm256_store_si256(reinterpret_cast<__m256i*>(next.diagonals.words + i), _mm256_and_si256(diagonals, _mm256_load_si256(reinterpret_cast<const __m256i*>(valid.words + i))));
+        _mm256_store_si256(reinterpret_cast<__m256i*>(next.anti_diagonals.words + i), anti_diagonals);
+    }
+#elif defined(BITSET_SSE2)
+    for (int i = BITSET_PAD; i < end; i += 2){
+
+        __m128i diagonals = _mm_or_si128(_mm_slli_epi64(_mm_load_si128(reinterpret_cast<const __m128i*>(current.diagonals.words + i)), 1),
+                                         _mm_srli_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(current.diagonals.words + i - 1)), 63));
+        __m128i anti_diagonals = _mm_or_si128(_mm_srli_epi64(_mm_load_si128(reinterpret_cast<const __m128i*>(current.anti_diagonals.words + i)), 1),
+                                              _mm_slli_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(current.anti_diagonals.words + i + 1)), 63));
+
+        _mm_store_si128(reinterpret_cast<__m128i*>(next.columns.words + i), _mm_load_si128(reinterpret_cast<const __m128i*>(current.columns.words + i)));
+        _mm_store_si128(reinterpret_cast<__m128i*>(next.diagonals.words + i), _mm_and_si128(diagonals, _mm_load_si128(reinterpret_cast<const __m128i*>(valid.words + i))));
+        _mm_store_si128(reinterpret_cast<__m128i*>(next.anti_diagonals.words + i), anti_diagonals);
+    }
+#else
+    for (int i = BITSET_PAD; i < end; i++){
+
+        next.columns.words[i] = current.columns.words[i];
+        next.diagonals.words[i] = ((current.diagonals.words[i] << 1) | (current.diagonals.words[i - 1] >> 63)) & valid.words[i];
+        next.anti_diagonals.words[i] = (current.anti_diagonals.words[i] >> 1) | (current.anti_diagonals.words[i + 1] << 63);
+    }
+#endif
+}
+
+// Solver por filas con conjuntos de bits de varias palabras. Cada fila tiene su propio marco, así que
+// colocar una reina es construir el marco siguiente (una pasada sobre N / 256 bloques) y deshacerla es
+// no hacer nada. Las columnas se prueban de menor a mayor, igual que backtracking(). Con más de
+// MAX_BITSET_SIZE columnas el tablero no cabe: valid queda en false y solve() devuelve false
+
+struct BitsetSolver{
+
+    int n;
+    bool valid;
+    int chunks;
+    Bitset board_columns; // Bits de las columnas 0..n-1
+    std::vector<Frame> frames;
+    std::vector<int> queens;
+    long long nodes = 0;
+    long long node_limit = -1; // Presupuesto de nodos (-1 sin límite)
+
+    BitsetSolver(int size) : n(size), valid(size >= 0 && size <= MAX_BITSET_SIZE), chunks(valid ? (size + 255) / 256 : 0),
+        board_columns(), frames(valid ? size + 1 : 1), queens(valid ? size : 0){
+
+        for (int column = 0; valid && column < n; column++){
+
+            board_columns.words[BITSET_PAD + (column >> 6)] |= 1ULL << (column & 63);
+
+        }
+    }
+
+    // La reina de la fila row ocupa su columna en todas las filas siguientes y sus diagonales una
+    // columna más a la derecha y una más a la izquierda en la fila row + 1
+
+    void place(int row, int column){
+
+        Frame& next = frames[row + 1];
+
+        advance_frame(frames[row], next, board_columns, chunks);
+
+        next.columns.words[BITSET_PAD + (column >> 6)] |= 1ULL << (column & 63);
+
+        if (column + 1 < n){
+
+            next.diagonals.words[BITSET_PAD + ((column + 1) >> 6)] |= 1ULL << ((column + 1) & 63);
+
+        }
+
+        if (column > 0){
+
+            next.anti_diagonals.words[BITSET_PAD + ((column - 1) >> 6)] |= 1ULL << ((column - 1) & 63);
+
+        }
+    }
+
+    bool search(int row){
+
+        if (row == n){
+
+            return true;
+
+        }
+
+        Bitset candidates;
+        free_columns(frames[row].columns, frames[row].diagonals, frames[row].anti_diagonals, board_columns, candidates, chunks);
+
+        for (int column = next_set_bit(candidates, 0, chunks); column >= 0; column = next_set_bit(candidates, column + 1, chunks)){
+
+            if (nodes == node_limit){
+
+                return false;
+
+            }
+
+            nodes++;
+            queens[row] = column;
+            place(row, column);
+
+            if (search(row + 1)){
+
+                return true;
+
+            }
+        }
+
+        return false;
+    }
+
+    bool solve(long long limit = -1){
+
+        nodes = 0;
+        node_limit = limit;
+
+        if (!valid){
+
+            return false;
+
+        }
+
+        frames[0] = Frame();
+
+        return search(0);
+    }
+};
+
+#endif
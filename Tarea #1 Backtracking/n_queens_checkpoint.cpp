@@ -0,0 +1,427 @@
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <climits>
+#include <string>
+#include <filesystem>
+#include "n_queens_count.h"
+using namespace std;
+using namespace std::chrono;
+
+const int MAX_BOARD_SIZE = 32;
+const uint32_t CHECKPOINT_MAGIC = 0x4b43514e; // "NQCK"
+const uint32_t CHECKPOINT_VERSION = 1;
+const long long CHECKPOINT_INTERVAL = 1LL << 26; // Nodos entre checkpoints en modo trabajo
+
+// Búsqueda iterativa con pila explícita. Todo el progreso vive en este objeto: la fila actual, las
+// columnas que faltan por probar en cada fila y las ocupaciones con las que se entró a cada fila,
+// así que se puede guardar en un archivo y retomar exactamente en el mismo punto
+
+struct IterativeSearch{
+
+    int n = 0;
+    int row = -1; // -1 cuando la búsqueda terminó
+    mask_t full = 0;
+    long long solutions = 0;
+    long long nodes = 0;
+    mask_t candidates[MAX_BOARD_SIZE]; // Columnas libres aún no probadas en cada fila
+    mask_t columns[MAX_BOARD_SIZE];
+    mask_t diagonals[MAX_BOARD_SIZE];
+    mask_t anti_diagonals[MAX_BOARD_SIZE];
+
+    void start(int size){
+
+        n = size;
+        full = full_mask(n);
+        row = 0;
+        solutions = 0;
+        nodes = 0;
+        columns[0] = diagonals[0] = anti_diagonals[0] = 0;
+        candidates[0] = full;
+    }
+
+    // Avanza hasta terminar o hasta visitar max_nodes nodos más. Devuelve true si terminó.
+    // Las máscaras de la fila actual viven en variables locales (como los parámetros de una llamada
+    // recursiva) y solo se pasan a la pila al bajar o al detenerse
+
+    bool run(long long max_nodes){
+
+        if (row < 0){
+
+            return true;
+
+        }
+
+        long long limit = nodes + max_nodes;
+        int current = row;
+        long long visited = nodes;
+        long long found = solutions;
+
+        mask_t free_columns = candidates[current];
+        mask_t current_columns = columns[current];
+        mask_t current_diagonals = diagonals[current];
+        mask_t current_anti_diagonals = anti_diagonals[current];
+
+        while (visited < limit){
+
+            if (!free_columns){
+
+                // Backtracking: se agotaron las columnas de esta fila
+
+                if (--current < 0){
+
+                    break;
+
+                }
+
+                free_columns = candidates[current];
+                current_columns = columns[current];
+                current_diagonals = diagonals[current];
+                current_anti_diagonals = anti_diagonals[current];
+                continue;
+            }
+
+            mask_t bit = free_columns & (~free_columns + 1);
+            free_columns &= free_columns - 1;
+            visited++;
+
+            mask_t next_columns = current_columns | bit;
+            mask_t next_diagonals = ((current_diagonals | bit) << 1) & full;
+            mask_t next_anti_diagonals = (current_anti_diagonals | bit) >> 1;
+            mask_t next_free = ~(next_columns | next_diagonals | next_anti_diagonals) & full;
+
+            if (current >= n - 2){
+
+                // En la última fila cada columna libre completa el tablero, así que no hace falta
+                // bajar a ella (con n = 1 la fila actual ya es la última)
+
+                found += (current == n - 1) ? 1 : __builtin_popcountll(next_free);
+                continue;
+
+            }
+
+            if (!next_free){
+
+                continue; // Callejón sin salida: no vale la pena apilar la fila siguiente
+
+            }
+
+            candidates[current] = free_columns;
+            current++;
+            columns[current] = current_columns = next_columns;
+            diagonals[current] = current_diagonals = next_diagonals;
+            anti_diagonals[current] = current_anti_diagonals = next_anti_diagonals;
+            free_columns = next_free;
+        }
+
+        if (current >= 0){
+
+            candidates[current] = free_columns;
+
+        }
+
+        row = current;
+        nodes = visited;
+        solutions = found;
+
+        return current < 0;
+    }
+
+    // Formato del checkpoint: cabecera (magia, versión, n, fila, soluciones, nodos) y luego las cuatro
+    // máscaras de cada fila activa. Se escribe en un archivo temporal y se renombra para que un corte
+    // a mitad de escritura no deje un checkpoint dañado
+
+    bool save(const string& path) const{
+
+        string temporary = path + ".tmp";
+
+        {
+            ofstream file(temporary, ios::binary | ios::trunc);
+
+            if (!file){
+
+                return false;
+
+            }
+
+            int32_t header[] = {static_cast<int32_t>(CHECKPOINT_MAGIC), static_cast<int32_t>(CHECKPOINT_VERSION), n, row};
+            file.write(reinterpret_cast<const char*>(header), sizeof(header));
+            file.write(reinterpret_cast<const char*>(&solutions), sizeof(solutions));
+            file.write(reinterpret_cast<const char*>(&nodes), sizeof(nodes));
+
+            for (int r = 0; r <= row; r++){
+
+                mask_t state[] = {candidates[r], columns[r], diagonals[r], anti_diagonals[r]};
+                file.write(reinterpret_cast<const char*>(state), sizeof(state));
+
+            }
+
+            if (!file){
+
+                return false;
+
+            }
+        }
+
+        return rename(temporary.c_str(), path.c_str()) == 0;
+    }
+
+    // Comprueba que las máscaras leídas sean un estado al que run() puede llegar: todo dentro del
+    // tablero, la fila 0 vacía y cada fila r igual a la anterior más una sola reina ya probada en
+    // la fila r - 1 (las columnas se prueban de menor a mayor, así que las pendientes son mayores)
+
+    bool consistent() const{
+
+        if (solutions < 0 || nodes < 0 || row > max(n - 2, 0)){
+
+            return false;
+
+        }
+
+        for (int r = 0; r <= row; r++){
+
+            mask_t free_columns = ~(columns[r] | diagonals[r] | anti_diagonals[r]) & full;
+
+            if ((candidates[r] & ~free_columns) || (columns[r] & ~full) || (diagonals[r] & ~full) || (anti_diagonals[r] & ~full)){
+
+                return false;
+
+            }
+
+            if (r == 0){
+
+                if (columns[0] || diagonals[0] || anti_diagonals[0]){
+
+                    return false;
+
+                }
+
+                continue;
+            }
+
+            mask_t previous_free = ~(columns[r - 1] | diagonals[r - 1] | anti_diagonals[r - 1]) & full;
+            mask_t bit = columns[r] & ~columns[r - 1];
+
+            if ((columns[r - 1] & ~columns[r]) || __builtin_popcountll(bit) != 1 || !(bit & previous_free) || (candidates[r - 1] & ((bit << 1) - 1))
+                || diagonals[r] != (((diagonals[r - 1] | bit) << 1) & full) || anti_diagonals[r] != ((anti_diagonals[r - 1] | bit) >> 1)){
+
+                return false;
+
+            }
+        }
+
+        return true;
+    }
+
+    // Un archivo truncado, con otra magia o versión, con bytes de más o con máscaras que no cuadran
+    // con N se rechaza
+
+    bool load(const string& path){
+
+        ifstream file(path, ios::binary);
+
+        if (!file){
+
+            return false;
+
+        }
+
+        int32_t header[4];
+        file.read(reinterpret_cast<char*>(header), sizeof(header));
+
+        if (!file || static_cast<uint32_t>(header[0]) != CHECKPOINT_MAGIC || static_cast<uint32_t>(header[1]) != CHECKPOINT_VERSION
+            || header[2] < 1 || header[2] > MAX_BOARD_SIZE || header[3] < -1 || header[3] >= header[2]){
+
+            return false;
+
+        }
+
+        n = header[2];
+        row = header[3];
+        full = full_mask(n);
+        file.read(reinterpret_cast<char*>(&solutions), sizeof(solutions));
+        file.read(reinterpret_cast<char*>(&nodes), sizeof(nodes));
+
+        for (int r = 0; r <= row; r++){
+
+            mask_t state[4];
+            file.read(reinterpret_cast<char*>(state), sizeof(state));
+
+            candidates[r] = state[0];
+            columns[r] = state[1];
+            diagonals[r] = state[2];
+            anti_diagonals[r] = state[3];
+        }
+
+        return file && file.peek() == ifstream::traits_type::eof() && consistent();
+    }
+};
+
+// Modo trabajo: retoma el checkpoint si existe y guarda uno cada CHECKPOINT_INTERVAL nodos. Solo se
+// empieza de cero si el archivo no existe; uno dañado se deja intacto y el trabajo falla, para no
+// perder el progreso sobrescribiéndolo
+
+int run_job(int n, const string& path){
+
+    if (n < 1 || n > MAX_BOARD_SIZE){
+
+        cout << "N must be between 1 and " << MAX_BOARD_SIZE << endl;
+        return 1;
+
+    }
+
+    IterativeSearch search;
+    error_code error;
+
+    if (!filesystem::exists(path, error)){
+
+        if (error){
+
+            cout << "Could not check checkpoint " << path << ": " << error.message() << endl;
+            return 1;
+
+        }
+
+        search.start(n);
+
+    } else if (!search.load(path)){
+
+        cout << "Checkpoint " << path << " is unreadable or corrupt; remove it to start over" << endl;
+        return 1;
+
+    } else{
+
+        if (search.n != n){
+
+            cout << "Checkpoint " << path << " is for N = " << search.n << ", not " << n << endl;
+            return 1;
+
+        }
+
+        cout << "Resuming N = " << n << " from " << path << " (" << search.nodes << " nodes, " << search.solutions << " solutions so far)" << endl;
+    }
+
+    while (!search.run(CHECKPOINT_INTERVAL)){
+
+        if (!search.save(path)){
+
+            cout << "Could not write checkpoint " << path << endl;
+            return 1;
+
+        }
+
+        cout << "Checkpoint: " << search.nodes << " nodes, " << search.solutions << " solutions" << endl;
+    }
+
+    if (!search.save(path)){ // El checkpoint final (fila -1) deja registrado el resultado
+
+        cout << "Could not write checkpoint " << path << endl;
+        return 1;
+
+    }
+
+    cout << "N = " << n << ": " << search.solutions << " solutions (" << search.nodes << " nodes)" << endl;
+
+    return 0;
+}
+
+int usage(){
+
+    cout << "Usage: n_queens_checkpoint [N CHECKPOINT]" << endl;
+    cout << "  N between 1 and " << MAX_BOARD_SIZE << "; without arguments runs the demo" << endl;
+
+    return 1;
+}
+
+int main(int argc, char* argv[]){
+
+    if (argc == 3){
+
+        int n = 0;
+
+        try{
+
+            size_t parsed = 0;
+            n = stoi(argv[1], &parsed);
+
+            if (argv[1][parsed] != '\0'){
+
+                return usage();
+
+            }
+
+        } catch (const exception&){
+
+            return usage(); // No es un número o no cabe en un int
+
+        }
+
+        return run_job(n, argv[2]);
+    }
+
+    if (argc != 1){
+
+        return usage();
+
+    }
+
+    // Sin argumentos: compara recursión contra pila explícita y comprueba que una búsqueda
+    // interrumpida y retomada desde disco en muchos puntos da el mismo conteo
+
+    const int N = 14;
+    const long long INTERVAL = 1000000;
+    const string PATH = "n_queens_checkpoint.bin";
+
+    auto start = high_resolution_clock::now();
+    long long recursive = count_solutions(0, N, full_mask(N), 0, 0, 0);
+    auto stop = high_resolution_clock::now();
+    auto recursive_duration = duration_cast<microseconds>(stop - start);
+
+    IterativeSearch search;
+    search.start(N);
+
+    start = high_resolution_clock::now();
+    search.run(LLONG_MAX);
+    stop = high_resolution_clock::now();
+    auto iterative_duration = duration_cast<microseconds>(stop - start);
+
+    IterativeSearch resumed;
+    resumed.start(N);
+    int checkpoints = 0;
+
+    start = high_resolution_clock::now();
+    while (!resumed.run(INTERVAL)){
+
+        if (!resumed.save(PATH)){
+
+            cout << "Could not write checkpoint " << PATH << endl;
+            return 1;
+
+        }
+
+        resumed = IterativeSearch();
+
+        if (!resumed.load(PATH)){
+
+            cout << "Could not read back checkpoint " << PATH << endl;
+            return 1;
+
+        }
+
+        checkpoints++;
+    }
+    stop = high_resolution_clock::now();
+    auto resumed_duration = duration_cast<microseconds>(stop - start);
+
+    remove(PATH.c_str());
+
+    cout << "N = " << N << endl;
+    cout << "Recursive: " << recursive << " solutions in " << recursive_duration.count() << " microseconds" << endl;
+    cout << "Iterative: " << search.solutions << " solutions in " << iterative_duration.count() << " microseconds" << endl;
+    cout << "Resumed from " << checkpoints << " checkpoints: " << resumed.solutions << " solutions in " << resumed_duration.count()
+         << " microseconds (" << (resumed.solutions == recursive && resumed.nodes == search.nodes ? "matches" : "MISMATCH") << ")" << endl;
+
+    return 0;
+}
@@ -0,0 +1,158 @@
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+#include "n_queens_completion.h"
+#include "n_queens_verify.h"
+using namespace std;
+using namespace std::chrono;
+
+// Referencia por fuerza bruta para tableros pequeños: ¿alguna solución contiene todas las reinas fijas?
+
+bool brute_force_completable(int row, int n, vector<int>& queens, const vector<int>& required){
+
+    if (row == n){
+
+        return valid_solution(queens);
+
+    }
+
+    for (int column = 0; column < n; column++){
+
+        if (required[row] >= 0 && required[row] != column){
+
+            continue;
+
+        }
+
+        bool safe = true;
+
+        for (int previous = 0; previous < row && safe; previous++){
+
+            safe = queens[previous] != column && abs(queens[previous] - column) != row - previous;
+
+        }
+
+        if (safe){
+
+            queens[row] = column;
+
+            if (brute_force_completable(row + 1, n, queens, required)){
+
+                return true;
+
+            }
+        }
+    }
+
+    return false;
+}
+
+int main(){
+
+    const int CHECKS_PER_N = 200;
+    const int MAX_CHECKED_N = 10;
+    mt19937 rng(123456789);
+
+    // Tableros pequeños contra fuerza bruta, incluyendo casos imposibles y entradas inválidas
+
+    int mismatches = 0;
+    int feasible = 0;
+    int infeasible = 0;
+
+    for (int n = 4; n <= MAX_CHECKED_N; n++){
+
+        for (int check = 0; check < CHECKS_PER_N; check++){
+
+            vector<pair<int, int>> fixed = random_placement(n, 1 + check % 3, rng);
+            vector<int> required(n, -1);
+            vector<int> queens(n);
+
+            for (const pair<int, int>& queen : fixed){
+
+                required[queen.first] = queen.second;
+
+            }
+
+            CompletionResult result = complete(n, fixed);
+            bool expected = brute_force_completable(0, n, queens, required);
+            bool consistent = result.status == (expected ? COMPLETED : NO_COMPLETION);
+
+            if (result.status == COMPLETED){
+
+                consistent = consistent && valid_solution(result.queens);
+
+                for (const pair<int, int>& queen : fixed){
+
+                    consistent = consistent && result.queens[queen.first] == queen.second;
+
+                }
+
+                feasible++;
+
+            } else{
+
+                infeasible++;
+
+            }
+
+            if (!consistent) mismatches++;
+        }
+    }
+
+    bool rejects_invalid = complete(8, {{0, 0}, {1, 1}}).status == INVALID_PLACEMENT && complete(8, {{0, 0}, {0, 5}}).status == INVALID_PLACEMENT
+                           && complete(8, {{8, 0}}).status == INVALID_PLACEMENT && complete(65, {}).status == INVALID_PLACEMENT;
+
+    cout << "Random placements, N = 4.." << MAX_CHECKED_N << ": " << feasible << " completed, " << infeasible << " infeasible, "
+         << mismatches << " mismatches against brute force" << endl;
+    cout << "Invalid placements rejected: " << (rejects_invalid ? "yes" : "no") << endl;
+
+    // Tableros grandes con algunas reinas fijas. El presupuesto de nodos evita que una instancia
+    // imposible muy difícil deje la prueba corriendo indefinidamente
+
+    const int LARGE_SIZES[] = {16, 32, 48, 64};
+    const int FIXED_QUEENS[] = {1, 4, 8};
+    const int INSTANCES = 20;
+    const long long NODE_BUDGET = 10000000;
+
+    for (int n : LARGE_SIZES){
+
+        for (int count : FIXED_QUEENS){
+
+            int results[4] = {0, 0, 0, 0};
+            long long total_nodes = 0;
+            vector<long long> durations;
+
+            for (int instance = 0; instance < INSTANCES; instance++){
+
+                vector<pair<int, int>> fixed = random_placement(n, count, rng);
+
+                auto start = high_resolution_clock::now();
+                CompletionResult result = complete(n, fixed, NODE_BUDGET);
+                auto stop = high_resolution_clock::now();
+
+                if (result.status == COMPLETED && !valid_solution(result.queens)){
+
+                    cout << "Invalid completion for N = " << n << endl;
+                    return 1;
+
+                }
+
+                results[result.status]++;
+                total_nodes += result.nodes;
+                durations.push_back(duration_cast<microseconds>(stop - start).count());
+            }
+
+            sort(durations.begin(), durations.end());
+
+            cout << "N = " << n << ", " << count << " fixed: " << results[COMPLETED] << " completed, " << results[NO_COMPLETION]
+                 << " infeasible, " << results[NODE_LIMIT_REACHED] << " over budget, median " << durations[INSTANCES / 2]
+                 << " microseconds, max " << durations.back() << " microseconds, " << total_nodes / INSTANCES << " nodes on average" << endl;
+        }
+    }
+
+    return 0;
+}
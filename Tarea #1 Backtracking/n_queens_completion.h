@@ -0,0 +1,202 @@
+#ifndef N_QUEENS_COMPLETION_H
+#define N_QUEENS_COMPLETION_H
+
+// Completar un tablero con reinas ya colocadas (n_queens_completion.cpp), para tableros de hasta
+// MAX_MASK_SIZE columnas. Lo usan n_queens_completion.cpp, n_queens_simd.cpp (estados de resultado y
+// generador de instancias) y n_queens_benchmark.cpp
+
+#include <cstdlib>
+#include <random>
+#include <utility>
+#include <vector>
+#include "n_queens_row.h"
+
+typedef unsigned __int128 wide_mask_t; // 2N - 1 diagonales caben en 128 bits para N <= 64
+
+// Resultado de completar un tablero con reinas ya colocadas
+
+enum CompletionStatus{ COMPLETED, NO_COMPLETION, INVALID_PLACEMENT, NODE_LIMIT_REACHED };
+
+const char* const COMPLETION_STATUS_NAMES[] = {"completed", "infeasible", "invalid placement", "node limit reached"};
+
+struct CompletionResult{
+
+    CompletionStatus status = INVALID_PLACEMENT;
+    std::vector<int> queens; // queens[fila] = columna, solo si status == COMPLETED
+    long long nodes = 0;
+
+};
+
+// Búsqueda sobre las filas libres. Como las reinas fijas pueden estar en cualquier fila, las
+// diagonales se guardan con índices absolutos (fila + columna y columna - fila + n - 1) en vez de
+// desplazarse fila a fila; las columnas libres de la fila r salen de correr esas máscaras r lugares.
+// En cada nodo se elige la fila libre con menos columnas disponibles (popcount), con empates a favor
+// de la fila más cercana al centro, igual que n_queens_mrv.cpp
+
+struct CompletionSolver{
+
+    int n;
+    mask_t full;
+    int queens[MAX_MASK_SIZE];
+    long long nodes = 0;
+    long long node_limit = -1; // -1 sin límite
+
+    CompletionSolver(int size) : n(size), full(size == 64 ? ~0ULL : ((1ULL << size) - 1)){}
+
+    mask_t free_columns(int row, mask_t columns, wide_mask_t diagonals, wide_mask_t anti_diagonals) const{
+
+        mask_t blocked = columns | static_cast<mask_t>(diagonals >> row) | static_cast<mask_t>(anti_diagonals >> (n - 1 - row));
+        return ~blocked & full;
+    }
+
+    // 1 si encontró solución, 0 si el subárbol no tiene ninguna, -1 si se agotó el presupuesto
+
+    int search(mask_t free_rows, mask_t columns, wide_mask_t diagonals, wide_mask_t anti_diagonals){
+
+        if (!free_rows){
+
+            return 1;
+
+        }
+
+        int row = -1;
+        int best = MAX_MASK_SIZE + 1;
+        mask_t candidates = 0;
+
+        for (mask_t rows = free_rows; rows; rows &= rows - 1){
+
+            int other = __builtin_ctzll(rows);
+            mask_t available = free_columns(other, columns, diagonals, anti_diagonals);
+            int count = __builtin_popcountll(available);
+
+            if (count < best || (count == best && std::abs(2 * other - n + 1) < std::abs(2 * row - n + 1))){
+
+                best = count;
+                row = other;
+                candidates = available;
+
+            }
+        }
+
+        while (candidates){
+
+            if (nodes == node_limit){
+
+                return -1;
+
+            }
+
+            nodes++;
+
+            mask_t bit = candidates & (~candidates + 1);
+            int column = __builtin_ctzll(bit);
+            queens[row] = column;
+
+            int found = search(free_rows & ~(1ULL << row), columns | bit, diagonals | (wide_mask_t(1) << (row + column)),
+                               anti_diagonals | (wide_mask_t(1) << (column - row + n - 1)));
+
+            if (found != 0){
+
+                return found;
+
+            }
+
+            candidates &= candidates - 1;
+        }
+
+        return 0;
+    }
+};
+
+// Completa un tablero de n x n con las reinas fijas dadas como pares (fila, columna). Las reinas fijas
+// deben estar dentro del tablero y no atacarse entre sí; si no, el resultado es INVALID_PLACEMENT
+
+inline CompletionResult complete(int n, const std::vector<std::pair<int, int>>& fixed, long long node_limit = -1){
+
+    CompletionResult result;
+
+    if (n < 1 || n > MAX_MASK_SIZE){
+
+        return result;
+
+    }
+
+    CompletionSolver solver(n);
+    solver.node_limit = node_limit;
+
+    mask_t free_rows = solver.full;
+    mask_t columns = 0;
+    wide_mask_t diagonals = 0;
+    wide_mask_t anti_diagonals = 0;
+
+    for (const std::pair<int, int>& queen : fixed){
+
+        int row = queen.first;
+        int column = queen.second;
+
+        if (row < 0 || row >= n || column < 0 || column >= n){
+
+            return result;
+
+        }
+
+        wide_mask_t diagonal = wide_mask_t(1) << (row + column);
+        wide_mask_t anti_diagonal = wide_mask_t(1) << (column - row + n - 1);
+
+        if (!(free_rows >> row & 1) || (columns >> column & 1) || (diagonals & diagonal) || (anti_diagonals & anti_diagonal)){
+
+            return result;
+
+        }
+
+        free_rows &= ~(1ULL << row);
+        columns |= 1ULL << column;
+        diagonals |= diagonal;
+        anti_diagonals |= anti_diagonal;
+        solver.queens[row] = column;
+    }
+
+    int found = solver.search(free_rows, columns, diagonals, anti_diagonals);
+
+    result.nodes = solver.nodes;
+    result.status = found > 0 ? COMPLETED : (found == 0 ? NO_COMPLETION : NODE_LIMIT_REACHED);
+
+    if (found > 0){
+
+        result.queens.assign(solver.queens, solver.queens + n);
+
+    }
+
+    return result;
+}
+
+// Reinas fijas al azar que no se atacan entre sí
+
+inline std::vector<std::pair<int, int>> random_placement(int n, int count, std::mt19937& rng){
+
+    std::vector<std::pair<int, int>> fixed;
+    std::uniform_int_distribution<int> position(0, n - 1);
+
+    while (static_cast<int>(fixed.size()) < count){
+
+        int row = position(rng);
+        int column = position(rng);
+        bool safe = true;
+
+        for (const std::pair<int, int>& queen : fixed){
+
+            safe = safe && queen.first != row && queen.second != column && std::abs(queen.first - row) != std::abs(queen.second - column);
+
+        }
+
+        if (safe){
+
+            fixed.push_back({row, column});
+
+        }
+    }
+
+    return fixed;
+}
+
+#endif
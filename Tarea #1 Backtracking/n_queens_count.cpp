@@ -0,0 +1,435 @@
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <thread>
+#include <cstdint>
+#ifdef __BMI2__
+#include <immintrin.h>
+#endif
+#include "n_queens_count.h"
+using namespace std;
+using namespace std::chrono;
+
+const int MAX_BOARD_SIZE = 32;
+const int MAX_CACHE_ROWS = 4; // Filas restantes máximas de un subproblema guardado en la caché (clave de 22 bits)
+
+// Estado de la búsqueda con simetrías: guarda la permutación actual (fila -> columna) y los conteos
+
+struct SymmetrySearch{
+
+    int n;
+    mask_t full;
+    bool use_symmetry; // Si es falso se explora el árbol completo (para comparar nodos)
+    int queens[MAX_BOARD_SIZE];
+    int inverse[MAX_BOARD_SIZE];
+    long long total = 0;
+    long long unique = 0;
+    long long nodes = 0;
+
+};
+
+// Caché de subproblemas para el conteo. Cuando quedan r filas también quedan exactamente r columnas
+// libres, y el número de formas de completar el tablero depende solo de qué casillas de esas r
+// columnas siguen libres en cada fila y de la distancia entre columnas libres consecutivas (dos
+// reinas de las filas restantes solo pueden compartir diagonal si sus columnas están a menos de r).
+// La clave junta una matriz de r x r bits con las r - 1 distancias (limitadas a r - 1) y para r <= 4
+// cabe en 22 bits, así que la tabla se indexa directamente: no hay colisiones ni reemplazos.
+//
+// El presupuesto de memoria elige la profundidad: se usa la mayor cantidad de filas, hasta la pedida,
+// cuya tabla cabe en el presupuesto (4 filas necesitan 4 MiB, 3 filas 8 KiB y 2 filas 32 bytes). Con
+// menos de eso la caché queda apagada (rows = 0) y cached_count() es el conteo sin caché. Una tabla
+// hash más chica con la clave completa en cada entrada acierta mucho menos con 4 filas (74% con
+// 1M entradas en N = 16) y pierde contra el conteo sin caché, así que no se usa.
+//
+// Cada fila de la matriz sale de un _pext_u64, así que la caché solo se activa con BMI2 (-mbmi2 o
+// -march=native); sin BMI2 queda apagada sin importar el presupuesto. Armar la clave bit a bit o
+// columna por columna la deja entre 0.9x y 1.1x del conteo sin caché. Con BMI2 y 4 filas casi todas
+// las consultas aciertan (más del 99% desde N = 16), pero cada acierto solo evita unos 3 nodos: la
+// ganancia medida va de 1.0x a 1.2x en N = 14..17, no más. Con 3 filas pierde y con 5 las claves
+// distintas crecen más rápido que las consultas (menos del 45% de aciertos con una tabla ilimitada
+// en N = 15)
+
+const int MIN_CACHE_ROWS = 2;
+
+// Bits de cada distancia entre columnas libres de la clave (valores de 0 a cached_rows - 1)
+
+constexpr int distance_bits(int cached_rows){
+
+    return cached_rows > 2 ? 2 : 1;
+
+}
+
+struct TranspositionCache{
+
+    int rows;
+    vector<int8_t> table; // Conteo de cada clave, -1 si todavía no se calculó (como mucho 4! = 24)
+    long long lookups = 0;
+    long long hits = 0;
+
+    static size_t table_bytes(int cached_rows){
+
+        return size_t(1) << (cached_rows * cached_rows + (cached_rows - 1) * distance_bits(cached_rows));
+
+    }
+
+    // Las profundidades fuera de [MIN_CACHE_ROWS, MAX_CACHE_ROWS] se recortan a ese rango y después se
+    // baja hasta que la tabla quepa en budget_bytes
+
+    TranspositionCache(int cached_rows, size_t budget_bytes) : rows(min(max(cached_rows, MIN_CACHE_ROWS), MAX_CACHE_ROWS)){
+
+#ifndef __BMI2__
+        budget_bytes = 0;
+#endif
+
+        while (rows >= MIN_CACHE_ROWS && table_bytes(rows) > budget_bytes){
+
+            rows--;
+
+        }
+
+        if (rows < MIN_CACHE_ROWS){
+
+            rows = 0;
+            return;
+
+        }
+
+        table.assign(table_bytes(rows), -1);
+    }
+
+    size_t memory_bytes() const{
+
+        return table.size() * sizeof(int8_t);
+
+    }
+
+#ifdef __BMI2__
+    // Construye la clave del estado fila por fila: _pext_u64 junta las casillas libres de cada fila
+    // restante en las columnas libres. Si alguna fila no tiene casillas libres devuelve false y el
+    // conteo es 0
+
+    template <int ROWS>
+    bool make_key(mask_t full, mask_t columns, mask_t diagonals, mask_t anti_diagonals, size_t& key) const{
+
+        mask_t free_columns = ~columns & full;
+        key = 0;
+
+        for (int i = 0; i < ROWS; i++){
+
+            mask_t free_cells = _pext_u64(~((diagonals << i) | (anti_diagonals >> i)), free_columns);
+
+            if (!free_cells){
+
+                return false;
+
+            }
+
+            key = (key << ROWS) | free_cells;
+        }
+
+        int previous = __builtin_ctzll(free_columns);
+        free_columns &= free_columns - 1;
+
+        while (free_columns){
+
+            int column = __builtin_ctzll(free_columns);
+
+            key = (key << distance_bits(ROWS)) | min(column - previous - 1, ROWS - 1);
+            previous = column;
+            free_columns &= free_columns - 1;
+        }
+
+        return true;
+    }
+#endif
+
+    bool find(size_t key, long long& count){
+
+        lookups++;
+
+        if (table[key] >= 0){
+
+            hits++;
+            count = table[key];
+            return true;
+
+        }
+
+        return false;
+    }
+
+    void store(size_t key, long long count){
+
+        table[key] = static_cast<int8_t>(count);
+
+    }
+};
+
+#ifdef __BMI2__
+// count_solutions() que consulta la caché cuando quedan ROWS filas. Por debajo de esa fila no hay nada
+// más que consultar, así que un fallo se resuelve con count_solutions() y se guarda
+
+template <int ROWS>
+long long cached_count(int row, int n, mask_t full, mask_t columns, mask_t diagonals, mask_t anti_diagonals, TranspositionCache& cache){
+
+    if (n - row == ROWS){
+
+        size_t key = 0;
+        long long count = 0;
+
+        if (!cache.make_key<ROWS>(full, columns, diagonals, anti_diagonals, key)){
+
+            return 0;
+
+        }
+
+        if (!cache.find(key, count)){
+
+            count = count_solutions(row, n, full, columns, diagonals, anti_diagonals);
+            cache.store(key, count);
+
+        }
+
+        return count;
+    }
+
+    if (row == n){
+
+        return 1;
+
+    }
+
+    long long count = 0;
+    mask_t free_columns = ~(columns | diagonals | anti_diagonals) & full;
+
+    while (free_columns){
+
+        mask_t bit = free_columns & (~free_columns + 1);
+
+        count += cached_count<ROWS>(row + 1, n, full, columns | bit, ((diagonals | bit) << 1) & full, (anti_diagonals | bit) >> 1, cache);
+
+        free_columns &= free_columns - 1;
+    }
+
+    return count;
+}
+#endif
+
+// Conteo completo de un tablero de n x n con la caché. La profundidad es un parámetro de plantilla
+// para que la clave se arme con desplazamientos constantes; una caché apagada (o un binario sin BMI2)
+// cuenta sin consultar
+
+long long cached_count(int n, TranspositionCache& cache){
+
+    static_assert(MAX_CACHE_ROWS == 4, "cached_count() solo instancia profundidades de 2 a 4 filas");
+
+    mask_t full = full_mask(n);
+
+#ifdef __BMI2__
+    switch (cache.rows){
+
+        case 2: return cached_count<2>(0, n, full, 0, 0, 0, cache);
+        case 3: return cached_count<3>(0, n, full, 0, 0, 0, cache);
+        case 4: return cached_count<4>(0, n, full, 0, 0, 0, cache);
+
+    }
+#else
+    (void) cache;
+#endif
+
+    return count_solutions(0, n, full, 0, 0, 0);
+}
+
+// Compara la solución con una de sus 8 transformaciones (rotaciones y reflejos) en orden lexicográfico.
+// transform indica si se refleja horizontalmente (bit 0), verticalmente (bit 1) o se transpone (bit 2)
+
+int compare_transform(const SymmetrySearch& state, int transform){
+
+    const int* source = (transform & 4) ? state.inverse : state.queens;
+    int n = state.n;
+
+    for (int i = 0; i < n; i++){
+
+        int column = source[(transform & 2) ? n - 1 - i : i];
+
+        if (transform & 1){
+
+            column = n - 1 - column;
+
+        }
+
+        if (column != state.queens[i]){
+
+            return column < state.queens[i] ? -1 : 1;
+
+        }
+    }
+
+    return 0;
+}
+
+// Si la solución es la menor de su clase, se cuenta como única y se pondera por el tamaño de su clase
+// (8 dividido entre la cantidad de transformaciones que la dejan igual)
+
+void classify_solution(SymmetrySearch& state){
+
+    for (int row = 0; row < state.n; row++){
+
+        state.inverse[state.queens[row]] = row;
+
+    }
+
+    int symmetries = 1; // La identidad
+
+    for (int transform = 1; transform < 8; transform++){
+
+        int comparison = compare_transform(state, transform);
+
+        if (comparison < 0){
+
+            return; // Otra transformación es menor: la clase ya se cuenta desde su representante
+
+        }
+
+        if (comparison == 0){
+
+            symmetries++;
+
+        }
+    }
+
+    state.unique++;
+    state.total += 8 / symmetries;
+}
+
+void symmetry_backtracking(int row, SymmetrySearch& state, mask_t columns, mask_t diagonals, mask_t anti_diagonals){
+
+    state.nodes++;
+
+    if (row == state.n){
+
+        if (state.use_symmetry){
+
+            classify_solution(state);
+
+        } else{
+
+            state.total++;
+
+        }
+
+        return;
+    }
+
+    mask_t free_columns = ~(columns | diagonals | anti_diagonals) & state.full;
+
+    // El representante lexicográfico de cada clase tiene la primera reina en la mitad izquierda, o en
+    // la columna central (N impar) con la segunda reina a la izquierda de ella. Basta con explorar esas
+    // ramas para encontrar a todos los representantes
+
+    if (state.use_symmetry && row == 0){
+
+        free_columns &= (1ULL << ((state.n + 1) / 2)) - 1;
+
+    }
+
+    if (state.use_symmetry && row == 1 && state.n % 2 == 1 && state.queens[0] == state.n / 2){
+
+        free_columns &= (1ULL << (state.n / 2)) - 1;
+
+    }
+
+    while (free_columns){
+
+        mask_t bit = free_columns & (~free_columns + 1);
+
+        state.queens[row] = __builtin_ctzll(bit);
+
+        symmetry_backtracking(row + 1, state, columns | bit, ((diagonals | bit) << 1) & state.full, (anti_diagonals | bit) >> 1);
+
+        free_columns &= free_columns - 1;
+    }
+}
+
+SymmetrySearch symmetry_count(int n, bool use_symmetry){
+
+    SymmetrySearch state;
+    state.n = n;
+    state.full = full_mask(n);
+    state.use_symmetry = use_symmetry;
+
+    symmetry_backtracking(0, state, 0, 0, 0);
+
+    return state;
+}
+
+int main(){
+
+    const int MIN_N = 10;
+    const int MAX_N = 15; // Subir hasta 20 para conteos largos
+    int threads = max(1u, thread::hardware_concurrency());
+
+    static_assert(MAX_N <= MAX_BOARD_SIZE, "El conteo usa mascaras de 64 bits con tableros de hasta 32x32");
+
+    cout << "Threads: " << threads << endl;
+    cout << "Transposition cache: " << (TranspositionCache(MAX_CACHE_ROWS, size_t(4) << 20).rows ? "BMI2 keys" : "disabled (build with -mbmi2)") << endl;
+
+    for (int n = MIN_N; n <= MAX_N; n++){
+
+        auto start = high_resolution_clock::now();
+        long long sequential = count_solutions(0, n, full_mask(n), 0, 0, 0);
+        auto stop = high_resolution_clock::now();
+        auto sequential_duration = duration_cast<microseconds>(stop - start);
+
+        start = high_resolution_clock::now();
+        long long parallel = parallel_count(n, threads);
+        stop = high_resolution_clock::now();
+        auto parallel_duration = duration_cast<microseconds>(stop - start);
+
+        bool matches = n < KNOWN_SOLUTIONS_SIZE && parallel == KNOWN_SOLUTIONS[n] && sequential == parallel;
+
+        cout << "N = " << n << ": " << parallel << " solutions (" << (matches ? "matches OEIS" : "MISMATCH") << ")" << endl;
+        cout << "  Sequential: " << sequential_duration.count() << " microseconds" << endl;
+        cout << "  Parallel: " << parallel_duration.count() << " microseconds (speedup "
+             << static_cast<double>(sequential_duration.count()) / max(1LL, static_cast<long long>(parallel_duration.count())) << "x)" << endl;
+
+        // Caché de subproblemas de 4 filas con dos presupuestos: 16 KiB solo alcanza para la tabla de
+        // 3 filas y 4 MiB para la de 4. Se informa el cociente de tiempos contra el conteo secuencial,
+        // que en este tamaño queda cerca de 1x
+
+        for (size_t budget_bytes : {size_t(16) << 10, size_t(4) << 20}){
+
+            TranspositionCache cache(MAX_CACHE_ROWS, budget_bytes);
+
+            if (!cache.rows){
+
+                continue;
+
+            }
+
+            start = high_resolution_clock::now();
+            long long cached = cached_count(n, cache);
+            stop = high_resolution_clock::now();
+            auto cached_duration = duration_cast<microseconds>(stop - start);
+
+            cout << "  Cache (budget " << (budget_bytes >> 10) << " KiB: " << cache.rows << " rows, " << (cache.memory_bytes() >> 10) << " KiB): "
+                 << (cached == sequential ? "matches" : "MISMATCH") << ", " << 100.0 * cache.hits / max(1LL, cache.lookups)
+                 << "% hits of " << cache.lookups << " lookups, " << cached_duration.count() << " microseconds (sequential / cached "
+                 << static_cast<double>(sequential_duration.count()) / max(1LL, static_cast<long long>(cached_duration.count())) << "x)" << endl;
+        }
+
+        SymmetrySearch full_tree = symmetry_count(n, false);
+
+        start = high_resolution_clock::now();
+        SymmetrySearch reduced = symmetry_count(n, true);
+        stop = high_resolution_clock::now();
+        auto symmetry_duration = duration_cast<microseconds>(stop - start);
+
+        cout << "  Symmetry: " << reduced.total << " total, " << reduced.unique << " unique ("
+             << (reduced.total == full_tree.total ? "matches" : "MISMATCH") << ") in " << symmetry_duration.count() << " microseconds" << endl;
+        cout << "  Nodes: " << reduced.nodes << " of " << full_tree.nodes << " ("
+             << 100.0 * reduced.nodes / full_tree.nodes << "%)" << endl;
+    }
+
+    return 0;
+}
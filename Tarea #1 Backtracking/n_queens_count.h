@@ -0,0 +1,204 @@
+#ifndef N_QUEENS_COUNT_H
+#define N_QUEENS_COUNT_H
+
+// Conteo de todas las soluciones con máscaras de bits, secuencial y repartido entre hilos con robo
+// de trabajo (n_queens_count.cpp). Lo usan n_queens_count.cpp, n_queens_distributed.cpp,
+// n_queens_benchmark.cpp y, para comprobar conteos, n_queens_checkpoint.cpp, n_queens_dlx.cpp y
+// n_queens_table.cpp
+
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+typedef unsigned long long mask_t;
+
+const int PREFIX_ROWS = 3; // Filas que se fijan para repartir el árbol de búsqueda entre hilos
+
+// Número de soluciones conocidas (OEIS A000170) para verificar los conteos
+
+const long long KNOWN_SOLUTIONS[] = {
+    1, 1, 0, 0, 2, 10, 4, 40, 92, 352, 724, 2680, 14200, 73712, 365596, 2279184,
+    14772512, 95815104, 666090624, 4968057848LL, 39029188884LL, 314666222712LL,
+    2691008701644LL, 24233937684440LL, 227514171973736LL, 2207893435808352LL,
+    22317699616364044LL, 234907967154122528LL
+};
+
+const int KNOWN_SOLUTIONS_SIZE = sizeof(KNOWN_SOLUTIONS) / sizeof(KNOWN_SOLUTIONS[0]);
+
+// Estado de las filas ya colocadas: columnas y diagonales ocupadas vistas desde la fila siguiente
+
+struct Prefix{
+
+    mask_t columns;
+    mask_t diagonals;
+    mask_t anti_diagonals;
+
+};
+
+// Cola de trabajo de cada hilo. Se alinea a 64 bytes para que los contadores de hilos distintos
+// no compartan línea de caché
+
+struct alignas(64) Worker{
+
+    std::mutex lock;
+    std::deque<Prefix> jobs;
+    long long count = 0;
+
+};
+
+inline mask_t full_mask(int n){
+
+    return (n == 64) ? ~0ULL : ((1ULL << n) - 1);
+
+}
+
+// Cuenta todas las soluciones a partir de la fila row (sin detenerse en la primera)
+
+inline long long count_solutions(int row, int n, mask_t full, mask_t columns, mask_t diagonals, mask_t anti_diagonals){
+
+    if (row == n){
+
+        return 1;
+
+    }
+
+    long long count = 0;
+    mask_t free_columns = ~(columns | diagonals | anti_diagonals) & full;
+
+    while (free_columns){
+
+        mask_t bit = free_columns & (~free_columns + 1);
+
+        count += count_solutions(row + 1, n, full, columns | bit, ((diagonals | bit) << 1) & full, (anti_diagonals | bit) >> 1);
+
+        free_columns &= free_columns - 1;
+    }
+
+    return count;
+}
+
+// Recorre todas las colocaciones válidas de las primeras prefix_rows filas. Por cada una llama a
+// visit(prefijo, queens), donde queens[i] es la columna de la reina de la fila i
+
+template <typename Visit>
+inline void for_each_prefix(int row, int prefix_rows, mask_t full, Prefix current, int queens[], Visit& visit){
+
+    if (row == prefix_rows){
+
+        visit(current, static_cast<const int*>(queens));
+        return;
+
+    }
+
+    mask_t free_columns = ~(current.columns | current.diagonals | current.anti_diagonals) & full;
+
+    while (free_columns){
+
+        mask_t bit = free_columns & (~free_columns + 1);
+
+        queens[row] = __builtin_ctzll(bit);
+
+        Prefix next = {current.columns | bit, ((current.diagonals | bit) << 1) & full, (current.anti_diagonals | bit) >> 1};
+        for_each_prefix(row + 1, prefix_rows, full, next, queens, visit);
+
+        free_columns &= free_columns - 1;
+    }
+}
+
+// Enumera todas las colocaciones válidas de las primeras prefix_rows filas
+
+inline void generate_prefixes(int prefix_rows, mask_t full, std::vector<Prefix>& prefixes){
+
+    std::vector<int> queens(std::max(prefix_rows, 1));
+    auto collect = [&prefixes](const Prefix& prefix, const int*){ prefixes.push_back(prefix); };
+
+    for_each_prefix(0, prefix_rows, full, Prefix{0, 0, 0}, queens.data(), collect);
+}
+
+// Saca un trabajo de la cola propia (por detrás) o, si está vacía, se lo roba a otro hilo (por delante)
+
+inline bool take_job(std::vector<Worker>& workers, int id, Prefix& job){
+
+    {
+        std::lock_guard<std::mutex> guard(workers[id].lock);
+
+        if (!workers[id].jobs.empty()){
+
+            job = workers[id].jobs.back();
+            workers[id].jobs.pop_back();
+            return true;
+
+        }
+    }
+
+    int threads = workers.size();
+
+    for (int offset = 1; offset < threads; offset++){
+
+        Worker& victim = workers[(id + offset) % threads];
+        std::lock_guard<std::mutex> guard(victim.lock);
+
+        if (!victim.jobs.empty()){
+
+            job = victim.jobs.front();
+            victim.jobs.pop_front();
+            return true;
+
+        }
+    }
+
+    return false; // No se generan trabajos nuevos, así que si todas las colas están vacías se terminó
+}
+
+// Conteo paralelo: reparte los prefijos de las primeras filas entre las colas de los hilos,
+// cada hilo acumula en su propio contador y al final se suman
+
+inline long long parallel_count(int n, int threads){
+
+    mask_t full = full_mask(n);
+    int prefix_rows = std::min(PREFIX_ROWS, n);
+
+    std::vector<Prefix> prefixes;
+    generate_prefixes(prefix_rows, full, prefixes);
+
+    std::vector<Worker> workers(threads);
+
+    for (size_t i = 0; i < prefixes.size(); i++){
+
+        workers[i % threads].jobs.push_back(prefixes[i]);
+
+    }
+
+    std::vector<std::thread> pool;
+
+    for (int id = 0; id < threads; id++){
+
+        pool.emplace_back([&workers, id, prefix_rows, n, full](){
+
+            Prefix job;
+            long long count = 0;
+
+            while (take_job(workers, id, job)){
+
+                count += count_solutions(prefix_rows, n, full, job.columns, job.diagonals, job.anti_diagonals);
+
+            }
+
+            workers[id].count = count;
+        });
+    }
+
+    long long total = 0;
+
+    for (int id = 0; id < threads; id++){
+
+        pool[id].join();
+        total += workers[id].count;
+    }
+
+    return total;
+}
+
+#endif
@@ -0,0 +1,406 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "n_queens_count.h"
+using namespace std;
+using namespace std::chrono;
+
+const int MAX_BOARD_SIZE = 32;
+const string JOBS_HEADER = "NQJOBS";
+const string PART_HEADER = "NQPART";
+
+// Los archivos se escriben en un temporal y se renombran, así un trabajador que muere a mitad de
+// escritura no deja un resultado parcial que merge pueda confundir con uno completo
+
+bool write_file(const string& path, const string& contents){
+
+    string temporary = path + ".tmp";
+
+    {
+        ofstream file(temporary, ios::trunc);
+        file << contents;
+
+        if (!file){
+
+            return false;
+
+        }
+    }
+
+    return rename(temporary.c_str(), path.c_str()) == 0;
+}
+
+// Archivo de trabajos (texto): "NQJOBS n k cantidad" y luego una línea por prefijo con sus k columnas.
+// Un archivo dañado o editado a mano se rechaza: cada columna debe estar en [0, n) y cada prefijo
+// debe ser una colocación válida, porque los trabajadores construyen las máscaras con 1 << columna
+
+struct JobFile{
+
+    int n = 0;
+    int k = 0;
+    vector<vector<int>> prefixes;
+
+    bool load(const string& path){
+
+        ifstream file(path);
+        string header;
+        size_t count = 0;
+
+        if (!(file >> header >> n >> k >> count) || header != JOBS_HEADER || n < 1 || n > MAX_BOARD_SIZE || k < 0 || k > n){
+
+            return false;
+
+        }
+
+        prefixes.clear();
+
+        for (size_t job = 0; job < count; job++){
+
+            vector<int> prefix(k);
+            mask_t columns = 0;
+            mask_t diagonals = 0;
+            mask_t anti_diagonals = 0;
+
+            for (int& column : prefix){
+
+                if (!(file >> column) || column < 0 || column >= n){
+
+                    return false;
+
+                }
+
+                mask_t bit = 1ULL << column;
+
+                if ((columns | diagonals | anti_diagonals) & bit){
+
+                    return false;
+
+                }
+
+                columns |= bit;
+                diagonals = (diagonals | bit) << 1;
+                anti_diagonals = (anti_diagonals | bit) >> 1;
+            }
+
+            prefixes.push_back(prefix);
+        }
+
+        return true;
+    }
+};
+
+// Resultado de un trabajador: "NQPART n k trabajos primero último soluciones" para los prefijos
+// [primero, último). k y la cantidad de trabajos identifican la división, así merge no mezcla
+// resultados de otra división del mismo N
+
+struct Part{
+
+    int n = 0;
+    int k = 0;
+    size_t jobs = 0;
+    size_t first = 0;
+    size_t last = 0;
+    long long solutions = 0;
+
+    bool load(const string& path){
+
+        ifstream file(path);
+        string header;
+
+        return (file >> header >> n >> k >> jobs >> first >> last >> solutions) && header == PART_HEADER && first <= last && last <= jobs;
+    }
+};
+
+int split(int n, int k, const string& jobs_path){
+
+    vector<int> queens(max(k, 1));
+    vector<vector<int>> prefixes;
+    auto collect = [&prefixes, k](const Prefix&, const int* prefix){ prefixes.emplace_back(prefix, prefix + k); };
+
+    for_each_prefix(0, k, full_mask(n), Prefix{0, 0, 0}, queens.data(), collect);
+
+    ostringstream contents;
+    contents << JOBS_HEADER << " " << n << " " << k << " " << prefixes.size() << "\n";
+
+    for (const vector<int>& current : prefixes){
+
+        for (int i = 0; i < k; i++){
+
+            contents << (i ? " " : "") << current[i];
+
+        }
+
+        contents << "\n";
+    }
+
+    if (!write_file(jobs_path, contents.str())){
+
+        cout << "Could not write " << jobs_path << endl;
+        return 1;
+
+    }
+
+    cout << "Split N = " << n << " at row " << k << ": " << prefixes.size() << " jobs in " << jobs_path << endl;
+
+    return 0;
+}
+
+// Procesa los prefijos [first, last) del archivo de trabajos. Cada trabajador es un proceso
+// independiente, así que basta con lanzar tantos como se quiera con rangos disjuntos
+
+int worker(const string& jobs_path, size_t first, size_t last, const string& part_path){
+
+    JobFile jobs;
+
+    if (!jobs.load(jobs_path)){
+
+        cout << "Could not read " << jobs_path << endl;
+        return 1;
+
+    }
+
+    last = min(last, jobs.prefixes.size());
+
+    if (first > last){
+
+        cout << "Empty or invalid range [" << first << ", " << last << ")" << endl;
+        return 1;
+
+    }
+
+    mask_t full = full_mask(jobs.n);
+    long long solutions = 0;
+
+    for (size_t job = first; job < last; job++){
+
+        mask_t columns = 0;
+        mask_t diagonals = 0;
+        mask_t anti_diagonals = 0;
+
+        for (int column : jobs.prefixes[job]){
+
+            mask_t bit = 1ULL << column;
+            columns |= bit;
+            diagonals = ((diagonals | bit) << 1) & full;
+            anti_diagonals = (anti_diagonals | bit) >> 1;
+        }
+
+        solutions += count_solutions(jobs.k, jobs.n, full, columns, diagonals, anti_diagonals);
+    }
+
+    ostringstream contents;
+    contents << PART_HEADER << " " << jobs.n << " " << jobs.k << " " << jobs.prefixes.size() << " " << first << " " << last << " " << solutions << "\n";
+
+    if (!write_file(part_path, contents.str())){
+
+        cout << "Could not write " << part_path << endl;
+        return 1;
+
+    }
+
+    cout << "Jobs [" << first << ", " << last << "): " << solutions << " solutions" << endl;
+
+    return 0;
+}
+
+// Suma los resultados parciales y comprueba que los rangos cubren todos los trabajos exactamente
+// una vez, para que un trabajador faltante o repetido no pase desapercibido
+
+int merge(const string& jobs_path, const vector<string>& part_paths, long long& total){
+
+    JobFile jobs;
+
+    if (!jobs.load(jobs_path)){
+
+        cout << "Could not read " << jobs_path << endl;
+        return 1;
+
+    }
+
+    vector<Part> parts;
+
+    for (const string& path : part_paths){
+
+        Part part;
+
+        if (!part.load(path)){
+
+            cout << "Invalid partial result " << path << endl;
+            return 1;
+
+        }
+
+        if (part.n != jobs.n || part.k != jobs.k || part.jobs != jobs.prefixes.size()){
+
+            cout << "Partial result " << path << " belongs to another split (N = " << part.n << ", K = " << part.k << ", "
+                 << part.jobs << " jobs)" << endl;
+            return 1;
+
+        }
+
+        parts.push_back(part);
+    }
+
+    sort(parts.begin(), parts.end(), [](const Part& a, const Part& b){ return a.first < b.first; });
+
+    size_t covered = 0;
+    total = 0;
+
+    for (const Part& part : parts){
+
+        if (part.first != covered){
+
+            cout << "Jobs [" << min(covered, part.first) << ", " << max(covered, part.first) << ") are "
+                 << (part.first > covered ? "missing" : "counted twice") << endl;
+            return 1;
+
+        }
+
+        covered = part.last;
+        total += part.solutions;
+    }
+
+    if (covered != jobs.prefixes.size()){
+
+        cout << "Jobs [" << covered << ", " << jobs.prefixes.size() << ") are missing" << endl;
+        return 1;
+
+    }
+
+    cout << "N = " << jobs.n << ": " << total << " solutions from " << parts.size() << " partial results" << endl;
+
+    return 0;
+}
+
+int usage(){
+
+    cout << "Usage:" << endl;
+    cout << "  n_queens_distributed split N K JOBS" << endl;
+    cout << "  n_queens_distributed worker JOBS FIRST LAST PART" << endl;
+    cout << "  n_queens_distributed merge JOBS PART..." << endl;
+
+    return 1;
+}
+
+// Números de la línea de comandos: todo el texto debe ser un número válido
+
+bool parse_number(const char* text, long long& value){
+
+    try{
+
+        size_t parsed = 0;
+        value = stoll(text, &parsed);
+        return text[parsed] == '\0';
+
+    } catch (const exception&){
+
+        return false;
+
+    }
+}
+
+int main(int argc, char* argv[]){
+
+    if (argc > 1){
+
+        string command = argv[1];
+
+        if (command == "split" && argc == 5){
+
+            long long n = 0;
+            long long k = 0;
+
+            if (!parse_number(argv[2], n) || !parse_number(argv[3], k)){
+
+                return usage();
+
+            }
+
+            if (n < 1 || n > MAX_BOARD_SIZE || k < 0 || k > n){
+
+                cout << "N must be between 1 and " << MAX_BOARD_SIZE << " and K between 0 and N" << endl;
+                return 1;
+
+            }
+
+            return split(n, k, argv[4]);
+        }
+
+        if (command == "worker" && argc == 6){
+
+            long long first = 0;
+            long long last = 0;
+
+            if (!parse_number(argv[3], first) || !parse_number(argv[4], last) || first < 0 || last < 0){
+
+                return usage();
+
+            }
+
+            return worker(argv[2], first, last, argv[5]);
+        }
+
+        if (command == "merge" && argc >= 4){
+
+            long long total = 0;
+            return merge(argv[2], vector<string>(argv + 3, argv + argc), total);
+
+        }
+
+        return usage();
+    }
+
+    // Sin argumentos: divide N = 13, reparte los trabajos entre 1, 3 y 7 trabajadores y comprueba que
+    // el total no depende de la partición
+
+    const int N = 13;
+    const int K = 3;
+    const string JOBS_PATH = "n_queens_jobs.txt";
+
+    long long expected = count_solutions(0, N, full_mask(N), 0, 0, 0);
+
+    if (split(N, K, JOBS_PATH) != 0){
+
+        return 1;
+
+    }
+
+    JobFile jobs;
+    jobs.load(JOBS_PATH);
+    size_t job_count = jobs.prefixes.size();
+
+    for (size_t workers : {1, 3, 7}){
+
+        vector<string> part_paths;
+
+        auto start = high_resolution_clock::now();
+        for (size_t id = 0; id < workers; id++){
+
+            string path = "n_queens_part_" + to_string(id) + ".txt";
+            worker(JOBS_PATH, job_count * id / workers, job_count * (id + 1) / workers, path);
+            part_paths.push_back(path);
+        }
+
+        long long total = 0;
+        int status = merge(JOBS_PATH, part_paths, total);
+        auto stop = high_resolution_clock::now();
+
+        for (const string& path : part_paths){
+
+            remove(path.c_str());
+
+        }
+
+        cout << workers << " workers: " << (status == 0 && total == expected ? "matches" : "MISMATCH") << " (" << expected
+             << " expected), " << duration_cast<microseconds>(stop - start).count() << " microseconds" << endl;
+    }
+
+    remove(JOBS_PATH.c_str());
+
+    return 0;
+}
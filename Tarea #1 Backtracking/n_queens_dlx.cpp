@@ -0,0 +1,76 @@
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include "n_queens_count.h"
+#include "n_queens_dlx.h"
+#include "n_queens_row.h"
+#include "n_queens_verify.h"
+using namespace std;
+using namespace std::chrono;
+
+const int MAX_COUNT_N = 13;
+const int MAX_FIRST_N = 32; // Para N mayores la referencia de orden fijo tarda minutos
+
+int main(){
+
+    // Modo conteo
+
+    cout << "Count mode" << endl;
+
+    for (int n = 1; n <= MAX_COUNT_N; n++){
+
+        DancingLinks links = build_n_queens(n);
+
+        auto start = high_resolution_clock::now();
+        long long total = links.count();
+        auto middle = high_resolution_clock::now();
+        long long reference = count_solutions(0, n, full_mask(n), 0, 0, 0);
+        auto stop = high_resolution_clock::now();
+
+        cout << "N = " << n << ": " << total << (total == KNOWN_SOLUTIONS[n] && total == reference ? "" : " (WRONG)") << " solutions, DLX "
+             << links.nodes << " nodes in " << duration_cast<microseconds>(middle - start).count() << " microseconds, bitmask count in "
+             << duration_cast<microseconds>(stop - middle).count() << " microseconds" << endl;
+    }
+
+    // Modo primera solución: la elección del ítem más corto hace que DLX encuentre una solución con
+    // muchos menos nodos que el orden fijo por filas
+
+    cout << "First-solution mode" << endl;
+
+    for (int n = 8; n <= MAX_FIRST_N; n += 4){
+
+        DancingLinks links = build_n_queens(n);
+        BitmaskSolver reference(n);
+        vector<int> options;
+
+        auto start = high_resolution_clock::now();
+        bool found = links.first(options);
+        auto middle = high_resolution_clock::now();
+        reference.bitmask_backtracking(0, 0, 0, 0);
+        auto stop = high_resolution_clock::now();
+
+        cout << "N = " << n << ": DLX " << (found && valid_solution(to_queens(options, n)) ? "solved" : "FAILED") << " with "
+             << links.nodes << " nodes in " << duration_cast<microseconds>(middle - start).count() << " microseconds, bitmask "
+             << reference.nodes << " nodes in " << duration_cast<microseconds>(stop - middle).count() << " microseconds" << endl;
+    }
+
+    // Modo enumeración: cada solución se valida y se cuentan las que tienen una reina en una esquina
+
+    const int ENUMERATE_N = 10;
+    DancingLinks links = build_n_queens(ENUMERATE_N);
+    int invalid = 0;
+    int corner = 0;
+
+    long long enumerated = links.enumerate([&invalid, &corner](const vector<int>& options){
+
+        vector<int> queens = to_queens(options, ENUMERATE_N);
+
+        if (!valid_solution(queens)) invalid++;
+        if (queens[0] == 0 || queens[0] == ENUMERATE_N - 1) corner++;
+    });
+
+    cout << "Enumerate mode, N = " << ENUMERATE_N << ": " << enumerated << " solutions, " << invalid << " invalid, "
+         << corner << " with a queen in a corner of the first row" << endl;
+
+    return 0;
+}
@@ -0,0 +1,56 @@
+#ifndef N_QUEENS_DLX_H
+#define N_QUEENS_DLX_H
+
+// Modelo de N reinas para dancing_links.h. Lo usan n_queens_dlx.cpp y n_queens_benchmark.cpp
+
+#include <vector>
+#include "dancing_links.h"
+
+// N reinas como cobertura exacta: cada fila y cada columna es un ítem primario (exactamente una
+// reina) y cada diagonal es secundario (a lo sumo una reina). La opción de la casilla (fila,
+// columna) tiene número fila * n + columna. Los primarios se ordenan desde el centro hacia los
+// bordes, alternando filas y columnas, porque las líneas centrales son las más restringidas
+
+inline DancingLinks build_n_queens(int n){
+
+    std::vector<int> index(2 * n); // Ítem asignado a cada fila (0..n-1) y columna (n..2n-1)
+    int next = 0;
+
+    for (int offset = 0; offset < n; offset++){
+
+        int line = (n - 1) / 2 + (offset % 2 ? (offset + 1) / 2 : -offset / 2);
+
+        index[line] = next++;
+        index[n + line] = next++;
+    }
+
+    DancingLinks links(2 * n, 2 * (2 * n - 1));
+
+    for (int row = 0; row < n; row++){
+
+        for (int column = 0; column < n; column++){
+
+            links.add_option({index[row], index[n + column], 2 * n + row + column, 2 * n + (2 * n - 1) + row - column + n - 1});
+
+        }
+    }
+
+    return links;
+}
+
+// Traduce las opciones elegidas a queens[fila] = columna
+
+inline std::vector<int> to_queens(const std::vector<int>& options, int n){
+
+    std::vector<int> queens(n, -1);
+
+    for (int cell : options){
+
+        queens[cell / n] = cell % n;
+
+    }
+
+    return queens;
+}
+
+#endif
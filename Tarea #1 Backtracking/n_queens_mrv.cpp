@@ -0,0 +1,180 @@
+#include <iostream>
+#include <chrono>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include "n_queens_bitset.h"
+#include "n_queens_mrv.h"
+#include "n_queens_row.h"
+#include "n_queens_verify.h"
+using namespace std;
+using namespace std::chrono;
+
+const long long NODE_BUDGET = 2000000; // Presupuesto de nodos de cada búsqueda
+const int MAX_CHECKED_N = 128; // Último N de la tabla de comprobación hacia adelante
+
+// Primera solución en el orden fijo de backtracking() con el motor de máscaras de n_queens_row.h, o
+// con el de conjuntos de bits de n_queens_bitset.h cuando el tablero no cabe en 64 bits. Los dos
+// cuentan los nodos como reinas colocadas, igual que MrvSolver. BitsetSolver no tiene comprobación
+// hacia adelante, así que forward_checking solo se pide hasta MAX_MASK_SIZE columnas
+
+struct FixedOrderRun{
+
+    bool found;
+    vector<int> queens;
+    long long nodes;
+    long long pruned;
+    double microseconds;
+
+};
+
+FixedOrderRun fixed_order(int n, long long node_budget, bool forward_checking = false){
+
+    FixedOrderRun run;
+
+    if (n <= MAX_MASK_SIZE){
+
+        BitmaskSolver solver(n);
+        solver.node_limit = node_budget;
+
+        auto start = high_resolution_clock::now();
+
+        if (forward_checking){
+
+            solver.bitmask_backtracking<true>(0, 0, 0, 0);
+
+        } else{
+
+            solver.bitmask_backtracking(0, 0, 0, 0);
+
+        }
+
+        auto stop = high_resolution_clock::now();
+
+        run.found = solver.solution_found;
+        run.queens = solver.queen_column;
+        run.nodes = solver.nodes;
+        run.pruned = solver.pruned;
+        run.microseconds = duration_cast<nanoseconds>(stop - start).count() / 1000.0;
+
+    } else{
+
+        BitsetSolver solver(n);
+
+        auto start = high_resolution_clock::now();
+        run.found = solver.solve(node_budget);
+        auto stop = high_resolution_clock::now();
+
+        run.queens = solver.queens;
+        run.nodes = solver.nodes;
+        run.pruned = 0;
+        run.microseconds = duration_cast<nanoseconds>(stop - start).count() / 1000.0;
+    }
+
+    return run;
+}
+
+string describe(bool solved, const vector<int>& queens, long long nodes, double microseconds){
+
+    string status = solved ? (valid_solution(queens) ? "solved" : "INVALID") : "budget exhausted";
+    return status + ", " + to_string(nodes) + " nodes, " + to_string(static_cast<long long>(microseconds)) + " microseconds";
+}
+
+int main(){
+
+    const int MIN_N = 32;
+    const int MAX_N = 200;
+    const int STEP = 8;
+
+    // El orden fijo se mide con BitmaskSolver hasta N = 64 y con BitsetSolver después
+
+    cout << "First solution, node budget " << NODE_BUDGET << " per search" << endl;
+
+    long long fixed_total_nodes = 0;
+    long long mrv_total_nodes = 0;
+    double fixed_total_microseconds = 0;
+    double mrv_total_microseconds = 0;
+    int fixed_solved = 0;
+    int mrv_solved = 0;
+
+    for (int n = MIN_N; n <= MAX_N; n += STEP){
+
+        FixedOrderRun fixed = fixed_order(n, NODE_BUDGET);
+
+        MrvSolver mrv(n);
+        mrv.node_limit = NODE_BUDGET;
+
+        auto start = high_resolution_clock::now();
+        bool mrv_found = mrv.solve();
+        auto stop = high_resolution_clock::now();
+        double mrv_microseconds = duration_cast<nanoseconds>(stop - start).count() / 1000.0;
+
+        fixed_total_nodes += fixed.nodes;
+        mrv_total_nodes += mrv.nodes;
+        fixed_total_microseconds += fixed.microseconds;
+        mrv_total_microseconds += mrv_microseconds;
+        fixed_solved += fixed.found;
+        mrv_solved += mrv_found;
+
+        cout << "N = " << n << ": fixed order " << describe(fixed.found, fixed.queens, fixed.nodes, fixed.microseconds)
+             << "; MRV " << describe(mrv_found, mrv.queens, mrv.nodes, mrv_microseconds) << endl;
+    }
+
+    // Los totales del orden fijo son cotas inferiores cuando se agotó el presupuesto
+
+    cout << "Fixed order: " << fixed_solved << " solved, " << fixed_total_nodes << " nodes, " << fixed_total_microseconds / 1000 << " milliseconds" << endl;
+    cout << "MRV: " << mrv_solved << " solved, " << mrv_total_nodes << " nodes, " << mrv_total_microseconds / 1000 << " milliseconds" << endl;
+    cout << "Node reduction: " << static_cast<double>(fixed_total_nodes) / max(1LL, mrv_total_nodes) << "x, time reduction: "
+         << fixed_total_microseconds / max(1.0, mrv_total_microseconds) << "x" << endl;
+
+    // Comprobación hacia adelante con el orden fijo sobre las máscaras desplazadas de BitmaskSolver.
+    // La primera solución en orden lexicográfico se alcanza sin presupuesto hasta N = 32 y las dos
+    // variantes deben dar la misma solución
+
+    cout << "Forward checking with fixed row order (BitmaskSolver)" << endl;
+
+    const int EXACT_SIZES[] = {28, 29, 30, 31, 32};
+
+    for (int n : EXACT_SIZES){
+
+        FixedOrderRun plain = fixed_order(n, -1);
+        FixedOrderRun checked = fixed_order(n, -1, true);
+
+        cout << "N = " << n << ": plain " << describe(plain.found, plain.queens, plain.nodes, plain.microseconds)
+             << "; forward checking " << describe(checked.found, checked.queens, checked.nodes, checked.microseconds)
+             << " (" << checked.pruned << " pruned, same solution: " << (plain.queens == checked.queens ? "yes" : "no")
+             << ", time ratio " << checked.microseconds / max(1.0, plain.microseconds) << "x)" << endl;
+    }
+
+    // Para N mayores el orden fijo agota el presupuesto con o sin la comprobación (se compara el
+    // trabajo hecho); eligiendo la fila con menos casillas libres se llega a la primera solución
+
+    cout << "Forward checking for N = " << MIN_N << ".." << MAX_CHECKED_N << ", node budget " << NODE_BUDGET << endl;
+
+    for (int n = MIN_N; n <= MAX_CHECKED_N; n += STEP){
+
+        FixedOrderRun plain = fixed_order(n, NODE_BUDGET);
+        FewestFreeCellsSolver fewest(n);
+        fewest.node_limit = NODE_BUDGET;
+
+        auto start = high_resolution_clock::now();
+        bool fewest_found = fewest.solve();
+        auto stop = high_resolution_clock::now();
+
+        cout << "N = " << n << ": plain " << describe(plain.found, plain.queens, plain.nodes, plain.microseconds);
+
+        if (n <= MAX_MASK_SIZE){
+
+            FixedOrderRun checked = fixed_order(n, NODE_BUDGET, true);
+            cout << "; forward checking " << describe(checked.found, checked.queens, checked.nodes, checked.microseconds);
+
+        }
+
+        cout << "; with fewest free cells first " << describe(fewest_found, fewest.queens, fewest.nodes, duration_cast<nanoseconds>(stop - start).count() / 1000.0)
+             << endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,430 @@
+#ifndef N_QUEENS_MRV_H
+#define N_QUEENS_MRV_H
+
+// Motores con orden dinámico de filas de n_queens_mrv.cpp: la fila más restringida primero con
+// columnas que menos restringen (MrvSolver) y la comprobación hacia adelante con la fila con menos
+// casillas libres (FewestFreeCellsSolver), para tableros de hasta MAX_MRV_SIZE columnas. Los usan
+// n_queens_mrv.cpp y n_queens_benchmark.cpp
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+typedef unsigned long long mask_t;
+
+const int MAX_MRV_SIZE = 256;
+const int MAX_MRV_WORDS = MAX_MRV_SIZE / 64;
+
+// Columnas libres de una fila, con el bit i en la palabra i / 64
+
+struct RowMask{
+
+    mask_t words[MAX_MRV_WORDS];
+
+};
+
+// Comprobación hacia adelante con la fila más restringida primero. Cada nivel guarda la máscara de
+// casillas libres de cada fila sin reina, como MrvSolver: colocar una reina copia el nivel y borra a
+// lo sumo tres bits por fila, y si alguna fila se queda sin casillas la rama se poda sin bajar hasta
+// ella. Con las máscaras al día elegir la fila con menos casillas libres cuesta un popcount por fila
+// y las columnas se prueban desde el centro hacia afuera. A diferencia de MrvSolver no se cuenta
+// cuántas casillas quita cada columna, que es lo caro de cada nodo. Con el orden fijo la comprobación
+// se hace sobre las máscaras desplazadas de BitmaskSolver (bitmask_backtracking<true>())
+
+struct FewestFreeCellsSolver{
+
+    int n;
+    int words;
+    std::vector<RowMask> levels; // levels[nivel * n + fila]
+    std::vector<int> column_order;
+    std::vector<int> queens; // -1 mientras la fila no tiene reina
+    bool valid;
+    long long nodes = 0;
+    long long node_limit = -1; // Presupuesto de nodos (-1 sin límite)
+    long long pruned = 0; // Colocaciones descartadas por la comprobación hacia adelante
+
+    FewestFreeCellsSolver(int size) : n(size), words((size + 63) / 64), valid(size >= 0 && size <= MAX_MRV_SIZE){
+
+        if (!valid){
+
+            return;
+
+        }
+
+        levels.resize((n + 1) * n);
+        column_order.resize(n);
+        queens.assign(n, -1);
+
+        for (int column = 0; column < n; column++){
+
+            column_order[column] = column;
+
+        }
+
+        std::stable_sort(column_order.begin(), column_order.end(), [this](int a, int b){
+
+            return std::abs(2 * a - n + 1) < std::abs(2 * b - n + 1);
+
+        });
+
+        for (int row = 0; row < n; row++){
+
+            RowMask& mask = levels[row];
+            std::fill(mask.words, mask.words + MAX_MRV_WORDS, 0);
+
+            for (int column = 0; column < n; column++){
+
+                mask.words[column >> 6] |= 1ULL << (column & 63);
+
+            }
+        }
+    }
+
+    static bool has(const RowMask& mask, int column){
+
+        return (mask.words[column >> 6] >> (column & 63)) & 1;
+
+    }
+
+    static void clear(RowMask& mask, int column){
+
+        mask.words[column >> 6] &= ~(1ULL << (column & 63));
+
+    }
+
+    int free_cells(const RowMask& mask) const{
+
+        int total = 0;
+
+        for (int i = 0; i < words; i++){
+
+            total += __builtin_popcountll(mask.words[i]);
+
+        }
+
+        return total;
+    }
+
+    // Fila sin reina con menos casillas libres (empates a favor de la más cercana al centro)
+
+    int next_row(int depth) const{
+
+        const RowMask* level = &levels[depth * n];
+        int row = -1;
+        int best = MAX_MRV_SIZE + 1;
+
+        for (int other = 0; other < n; other++){
+
+            if (queens[other] >= 0){
+
+                continue;
+
+            }
+
+            int cells = free_cells(level[other]);
+
+            if (cells < best || (cells == best && std::abs(2 * other - n + 1) < std::abs(2 * row - n + 1))){
+
+                best = cells;
+                row = other;
+
+            }
+        }
+
+        return row;
+    }
+
+    // Copia las máscaras de las filas sin reina al nivel siguiente quitando las casillas que ataca la
+    // reina en (fila, columna). Devuelve false en cuanto alguna se queda vacía
+
+    bool place(int depth, int row, int column){
+
+        const RowMask* current = &levels[depth * n];
+        RowMask* next = &levels[(depth + 1) * n];
+
+        for (int other = 0; other < n; other++){
+
+            if (queens[other] >= 0){
+
+                continue;
+
+            }
+
+            next[other] = current[other];
+            int distance = std::abs(other - row);
+
+            clear(next[other], column);
+            if (column - distance >= 0) clear(next[other], column - distance);
+            if (column + distance < n) clear(next[other], column + distance);
+
+            if (!free_cells(next[other])){
+
+                return false;
+
+            }
+        }
+
+        return true;
+    }
+
+    bool search(int depth){
+
+        if (depth == n){
+
+            return true;
+
+        }
+
+        int row = next_row(depth);
+
+        for (int column : column_order){
+
+            if (!has(levels[depth * n + row], column)){
+
+                continue;
+
+            }
+
+            if (nodes == node_limit){
+
+                return false;
+
+            }
+
+            nodes++;
+            queens[row] = column;
+
+            if (!place(depth, row, column)){
+
+                pruned++;
+
+            } else if (search(depth + 1)){
+
+                return true;
+
+            }
+
+            queens[row] = -1;
+        }
+
+        return false;
+    }
+
+    // Primera solución desde el tablero vacío. Devuelve false si no existe, si el tablero tiene más
+    // de MAX_MRV_SIZE columnas o si se agotó node_limit
+
+    bool solve(){
+
+        return valid && search(0);
+
+    }
+};
+
+// Orden "el más restringido primero": en cada nivel se elige la fila sin reina con menos casillas
+// libres (popcount de su máscara) y sus columnas se prueban empezando por la que menos casillas quita
+// a las demás filas. Cada nivel guarda las máscaras de todas las filas, así que colocar una reina es
+// copiar el nivel y borrar a lo sumo tres bits por fila; deshacerla es volver al nivel anterior
+
+struct MrvSolver{
+
+    int n;
+    int words;
+    std::vector<RowMask> levels; // levels[nivel * n + fila]
+    std::vector<int> queens; // -1 mientras la fila no tiene reina
+    bool valid;
+    long long nodes = 0;
+    long long node_limit = -1; // Presupuesto de nodos (-1 sin límite)
+
+    MrvSolver(int size) : n(size), words((size + 63) / 64), valid(size >= 0 && size <= MAX_MRV_SIZE){
+
+        if (!valid){
+
+            return;
+
+        }
+
+        levels.resize((n + 1) * n);
+        queens.assign(n, -1);
+
+        for (int row = 0; row < n; row++){
+
+            RowMask& mask = levels[row];
+            std::fill(mask.words, mask.words + MAX_MRV_WORDS, 0);
+
+            for (int column = 0; column < n; column++){
+
+                mask.words[column >> 6] |= 1ULL << (column & 63);
+
+            }
+        }
+    }
+
+    int free_cells(const RowMask& mask) const{
+
+        int total = 0;
+
+        for (int i = 0; i < words; i++){
+
+            total += __builtin_popcountll(mask.words[i]);
+
+        }
+
+        return total;
+    }
+
+    static bool has(const RowMask& mask, int column){
+
+        return (mask.words[column >> 6] >> (column & 63)) & 1;
+
+    }
+
+    static void clear(RowMask& mask, int column){
+
+        mask.words[column >> 6] &= ~(1ULL << (column & 63));
+
+    }
+
+    // Casillas libres de otras filas que quedarían atacadas por una reina en (fila, columna)
+
+    int eliminated(int depth, int row, int column) const{
+
+        const RowMask* level = &levels[depth * n];
+        int total = 0;
+
+        for (int other = 0; other < n; other++){
+
+            if (other == row || queens[other] >= 0){
+
+                continue;
+
+            }
+
+            int distance = std::abs(other - row);
+
+            total += has(level[other], column);
+            total += column - distance >= 0 && has(level[other], column - distance);
+            total += column + distance < n && has(level[other], column + distance);
+        }
+
+        return total;
+    }
+
+    void place(int depth, int row, int column){
+
+        const RowMask* current = &levels[depth * n];
+        RowMask* next = &levels[(depth + 1) * n];
+
+        for (int other = 0; other < n; other++){
+
+            if (queens[other] >= 0){
+
+                continue;
+
+            }
+
+            next[other] = current[other];
+            int distance = std::abs(other - row);
+
+            clear(next[other], column);
+            if (column - distance >= 0) clear(next[other], column - distance);
+            if (column + distance < n) clear(next[other], column + distance);
+        }
+    }
+
+    bool search(int depth){
+
+        if (depth == n){
+
+            return true;
+
+        }
+
+        // Fila más restringida; si alguna se quedó sin casillas este nodo ya no tiene solución. Los
+        // empates se rompen a favor de la fila más cercana al centro: con el desempate por índice la
+        // búsqueda se atasca en varios N mayores que 100
+
+        const RowMask* level = &levels[depth * n];
+        int row = -1;
+        int best = MAX_MRV_SIZE + 1;
+
+        for (int other = 0; other < n; other++){
+
+            if (queens[other] >= 0){
+
+                continue;
+
+            }
+
+            int cells = free_cells(level[other]);
+
+            if (cells < best || (cells == best && std::abs(2 * other - n + 1) < std::abs(2 * row - n + 1))){
+
+                best = cells;
+                row = other;
+
+            }
+        }
+
+        if (best == 0){
+
+            return false;
+
+        }
+
+        // Columnas ordenadas por cuántas casillas eliminan (desempate por cercanía al centro)
+
+        int order[MAX_MRV_SIZE];
+        int cost[MAX_MRV_SIZE];
+        int candidates = 0;
+
+        for (int column = 0; column < n; column++){
+
+            if (has(level[row], column)){
+
+                cost[column] = eliminated(depth, row, column);
+                order[candidates++] = column;
+
+            }
+        }
+
+        std::sort(order, order + candidates, [this, &cost](int a, int b){
+
+            return cost[a] != cost[b] ? cost[a] < cost[b] : std::abs(2 * a - n + 1) < std::abs(2 * b - n + 1);
+
+        });
+
+        for (int i = 0; i < candidates; i++){
+
+            if (nodes == node_limit){
+
+                return false;
+
+            }
+
+            nodes++;
+            queens[row] = order[i];
+            place(depth, row, order[i]);
+
+            if (search(depth + 1)){
+
+                return true;
+
+            }
+
+            queens[row] = -1;
+        }
+
+        return false;
+    }
+
+    // Primera solución desde el tablero vacío. Devuelve false si no existe, si el tablero tiene más
+    // de MAX_MRV_SIZE columnas o si se agotó node_limit
+
+    bool solve(){
+
+        return valid && search(0);
+
+    }
+};
+
+#endif
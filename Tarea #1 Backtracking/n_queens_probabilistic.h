@@ -0,0 +1,674 @@
+#ifndef N_QUEENS_PROBABILISTIC_H
+#define N_QUEENS_PROBABILISTIC_H
+
+// Motores aleatorios de n_queens_probabilistic_opt.cpp: backtracking probabilístico (con su modo
+// adaptativo), mínimos conflictos para tableros muy grandes y la carrera entre hilos con reinicios de
+// Luby. Los usan n_queens_probabilistic_opt.cpp y n_queens_benchmark.cpp
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "n_queens_row.h"
+#include "n_queens_stats.h"
+#include "fast_rng.h"
+
+const double PROBABILITY = 0.3;
+const int GREEDY_ATTEMPTS = 32; // Columnas aleatorias que se prueban por fila en la permutación inicial
+const int REPAIR_STEPS_PER_QUEEN = 20; // Presupuesto de intercambios de la fase de reparación
+const long long MIN_REPAIR_STEPS = 1000000; // Presupuesto mínimo para tableros pequeños
+const double ADAPTIVE_RISK = 0.1; // Probabilidad aceptada de que todos los hijos de un nodo sean callejones sin salida
+const int ADAPTIVE_ATTEMPTS = 100000; // Intentos máximos del modo adaptativo antes de rendirse
+const long long LUBY_UNIT = 1000; // Nodos por unidad de la secuencia de Luby en los reinicios
+
+// Solver probabilístico con tablero de enteros. El tablero, la bandera de solución y el generador
+// de números aleatorios son del objeto, así que cada hilo puede tener su propio solver. El
+// generador es un parámetro de plantilla (Pcg32, Xoshiro128 o std::mt19937, ver fast_rng.h) y stream
+// elige un flujo independiente para la semilla dada.
+//
+// Cada fila tiene un búfer de columnas reservado al construir el solver. En vez de barajar una
+// copia nueva de las n columnas en cada nodo, se sortean solo las que se van a probar con un
+// Fisher-Yates parcial sobre el búfer de la fila. El búfer sigue siendo una permutación de las
+// columnas después de cada sorteo, así que no hace falta reiniciarlo entre nodos
+
+template <typename Rng = Pcg32>
+struct ProbabilisticSolver{
+
+    int n;
+    std::vector<std::vector<int>> board;
+    bool solution_found = false;
+    Rng rng;
+    std::vector<std::vector<int>> column_order; // Permutación de las columnas de cada fila
+    long long nodes = 0; // Reinas colocadas por probabilistic_backtracking()
+    SearchStats stats; // Vacío salvo que se compile con -DNQ_STATS
+
+    ProbabilisticSolver(int size, unsigned seed, unsigned stream = 0) : n(size), board(size, std::vector<int>(size, 0)), rng(make_stream<Rng>(seed, stream)),
+                                                                       column_order(size + 1, std::vector<int>(size)){
+
+        for (std::vector<int>& order : column_order){
+
+            std::iota(order.begin(), order.end(), 0);
+
+        }
+
+        stats.reset(size);
+    }
+
+    // Intercambia la posición i del búfer con una posición al azar de [i, count): después de las
+    // llamadas con i = 0..k-1, order[0..k-1] es una muestra uniforme sin repetición de order[0..count-1]
+
+    int draw(std::vector<int>& order, int i, int count){
+
+        std::swap(order[i], order[i + uniform_below(rng, count - i)]);
+        return order[i];
+    }
+
+    /* void print_board(){
+
+        for (int i = 0; i < n; i++){
+
+            for (int j = 0; j < n; j++){
+
+                if (board[i][j] < 0){
+
+                    std::cout << "Q" << -board[i][j] << " ";
+                
+                } else{
+
+                    std::cout << ".  ";
+                }
+            }
+            std::cout << std::endl;
+        }
+    } */
+
+    void check_box(int row, int column, int queen_ID, bool mark){
+
+        SearchStats::timestamp start = stats.start_timer();
+        stats.mark(mark);
+
+        for(int i = 0; i < n; i++){
+
+            if (mark){
+
+                if(board[i][column] == 0){
+
+                    board[i][column] = queen_ID;
+
+                }
+
+            }else{
+                if(board[i][column] == queen_ID){
+
+                    board[i][column] = 0;
+                }
+            }
+        }
+
+        for (int step = 1; step < n; step++){
+
+            if (row + step < n && column + step < n){
+
+                if (mark){
+
+                    if (board[row + step][column + step] == 0){
+
+                        board[row + step][column + step] = queen_ID;
+
+                    }
+                } else{
+
+                    if (board[row + step][column + step] == queen_ID){
+
+                        board[row + step][column + step] = 0;
+                    }
+                }
+            }
+
+            if(row - step >= 0 && column - step >= 0){
+
+                if (mark){
+
+                    if (board[row - step][column - step] == 0){
+
+                        board[row - step][column - step] = queen_ID;
+
+                    }
+                }else{
+
+                    if (board[row - step][column - step] == queen_ID){
+
+                        board[row - step][column - step] = 0;
+
+                    }
+                }
+            }
+
+            if(row + step < n && column - step >= 0){
+
+                if (mark){
+
+                    if (board[row + step][column - step] == 0){
+
+                        board[row + step][column - step] = queen_ID;
+
+                    }
+                }else{
+
+                    if (board[row + step][column - step] == queen_ID){
+
+                        board[row + step][column - step] = 0;
+                    }
+                }
+            }
+
+            if (row - step >= 0 && column + step < n){
+
+                if (mark){
+
+                    if (board[row - step][column + step] == 0){
+
+                        board[row - step][column + step] = queen_ID;
+
+                    }
+                }else{
+
+                    if (board[row - step][column + step] == queen_ID){
+
+                        board[row - step][column + step] = 0;
+                    }
+                }
+            }
+        }
+
+        if (mark){
+
+            board[row][column] = -queen_ID;
+
+        } else{
+
+            board[row][column] = 0;
+        }
+        stats.stop_marking(start);
+    }
+
+    void probabilistic_backtracking(int row, int queen_ID){
+
+        if (solution_found) return;
+
+        stats.node(row);
+
+        if (row == n){
+
+            solution_found = true;
+            // print_board();
+            return;
+
+        }
+
+        std::vector<int>& columns = column_order[row];
+        int positions_to_check = std::max(1, static_cast<int>(n * PROBABILITY));
+
+        bool placed = false;
+
+        for (int i = 0; i < positions_to_check; i++){
+
+            int column = draw(columns, i, n);
+
+            stats.check();
+
+            if (board[row][column] == 0){
+
+                placed = true;
+                nodes++;
+                stats.branch(row);
+
+                check_box(row, column, queen_ID, true);
+
+                probabilistic_backtracking(row + 1, queen_ID + 1);
+
+                if (solution_found) return;
+
+                stats.backtrack(row);
+                check_box(row, column, queen_ID, false);
+            }
+        }
+
+        if (!placed){
+
+            stats.dead_end(row);
+
+        }
+    }
+
+    void reset_board(){
+
+        solution_found = false;
+        nodes = 0;
+
+        for (int i = 0; i < n; i++) {
+            std::fill(board[i].begin(), board[i].end(), 0);
+        }
+    }
+    // Modo adaptativo: en vez de probar n * PROBABILITY columnas en todas las filas, cada fila prueba
+    // tantas columnas libres como hagan falta según lo observado en la fila siguiente. Si una fracción
+    // d de los nodos de la fila r + 1 no tiene ninguna columna libre, con b hijos la probabilidad de que
+    // todos fallen de inmediato es d^b, así que se usa el menor b con d^b <= ADAPTIVE_RISK. Arriba casi
+    // no hay callejones (b = 1, una colocación golosa) y al fondo se ramifica más. Las estadísticas
+    // se acumulan entre intentos y entre llamadas, así que el solver aprende con el uso
+
+    std::vector<long long> depth_visits; // Nodos visitados en cada fila
+    std::vector<long long> depth_dead_ends; // Nodos de cada fila sin ninguna columna libre
+    std::vector<std::vector<int>> free_columns; // Columnas libres de cada fila, compactadas al inicio del búfer
+
+    int branching_budget(int row, int free_count){
+
+        if (row + 1 >= n){
+
+            return 1; // La última fila no necesita alternativas: cualquier columna libre completa el tablero
+
+        }
+
+        // Estimación con suavizado de Laplace para filas con pocas observaciones
+        double dead_end_rate = (depth_dead_ends[row + 1] + 1.0) / (depth_visits[row + 1] + 2.0);
+        int budget = static_cast<int>(std::ceil(std::log(ADAPTIVE_RISK) / std::log(dead_end_rate)));
+
+        return std::max(1, std::min(free_count, budget));
+    }
+
+    void adaptive_backtracking(int row, int queen_ID){
+
+        if (solution_found) return;
+
+        if (row == n){
+
+            solution_found = true;
+            return;
+
+        }
+
+        std::vector<int>& columns = free_columns[row];
+        int free_count = 0;
+
+        for (int column = 0; column < n; column++){
+
+            if (board[row][column] == 0) columns[free_count++] = column;
+
+        }
+
+        depth_visits[row]++;
+
+        if (free_count == 0){
+
+            depth_dead_ends[row]++;
+            return;
+
+        }
+
+        int positions_to_check = branching_budget(row, free_count);
+
+        for (int i = 0; i < positions_to_check; i++){
+
+            int column = draw(columns, i, free_count);
+
+            check_box(row, column, queen_ID, true);
+
+            adaptive_backtracking(row + 1, queen_ID + 1);
+
+            if (solution_found) return;
+
+            check_box(row, column, queen_ID, false);
+        }
+    }
+
+    // Repite intentos con el tablero vacío hasta encontrar una solución o agotar ADAPTIVE_ATTEMPTS
+
+    int adaptive_solve(){
+
+        depth_visits.resize(n + 1, 0);
+        depth_dead_ends.resize(n + 1, 0);
+        free_columns.resize(n + 1, std::vector<int>(n));
+
+        for (int attempt = 1; attempt <= ADAPTIVE_ATTEMPTS; attempt++){
+
+            reset_board();
+            adaptive_backtracking(0, 1);
+
+            if (solution_found){
+
+                return attempt;
+
+            }
+        }
+
+        return 0;
+    }
+};
+
+// Solver de mínimos conflictos para tableros muy grandes. Las reinas forman una permutación
+// (una por fila y por columna), así que solo hacen falta contadores O(N) de las dos diagonales.
+// Se parte de una permutación golosa y se reparan los conflictos restantes intercambiando columnas.
+// Como ProbabilisticSolver, stream elige un flujo independiente para la semilla dada
+
+struct MinConflictsSolver{
+
+    int n;
+    std::vector<int> queens; // queens[fila] = columna
+    std::vector<int> diagonals; // Reinas en cada diagonal fila + columna
+    std::vector<int> anti_diagonals; // Reinas en cada diagonal fila - columna + n - 1
+    long long conflicts = 0; // Pares de reinas que comparten diagonal (contados por reina extra)
+    long long initial_conflicts = 0;
+    long long iterations = 0;
+    long long swaps = 0;
+    long long restarts = 0;
+    std::mt19937 rng;
+
+    MinConflictsSolver(int size, unsigned seed, unsigned stream = 0) : n(size), queens(size), diagonals(2 * size - 1), anti_diagonals(2 * size - 1),
+                                                                       rng(make_stream<std::mt19937>(seed, stream)){}
+
+    void add(int row){
+
+        int& diagonal = diagonals[row + queens[row]];
+        int& anti_diagonal = anti_diagonals[row - queens[row] + n - 1];
+
+        if (diagonal > 0) conflicts++;
+        if (anti_diagonal > 0) conflicts++;
+
+        diagonal++;
+        anti_diagonal++;
+    }
+
+    void remove(int row){
+
+        int& diagonal = diagonals[row + queens[row]];
+        int& anti_diagonal = anti_diagonals[row - queens[row] + n - 1];
+
+        diagonal--;
+        anti_diagonal--;
+
+        if (diagonal > 0) conflicts--;
+        if (anti_diagonal > 0) conflicts--;
+    }
+
+    bool attacked(int row, int column) const{
+
+        return diagonals[row + column] > 0 || anti_diagonals[row - column + n - 1] > 0;
+
+    }
+
+    bool in_conflict(int row) const{
+
+        return diagonals[row + queens[row]] > 1 || anti_diagonals[row - queens[row] + n - 1] > 1;
+
+    }
+
+    // Permutación inicial: para cada fila se buscan columnas aún libres que no ataquen a las reinas
+    // ya colocadas; si ninguna de las probadas sirve se acepta la última
+
+    void greedy_start(){
+
+        std::iota(queens.begin(), queens.end(), 0);
+        std::fill(diagonals.begin(), diagonals.end(), 0);
+        std::fill(anti_diagonals.begin(), anti_diagonals.end(), 0);
+        conflicts = 0;
+
+        for (int row = 0; row < n; row++){
+
+            std::uniform_int_distribution<int> pick(row, n - 1);
+
+            for (int attempt = 0; attempt < GREEDY_ATTEMPTS; attempt++){
+
+                int candidate = pick(rng);
+                std::swap(queens[row], queens[candidate]);
+
+                if (!attacked(row, queens[row])){
+
+                    break;
+
+                }
+            }
+
+            add(row);
+        }
+
+        initial_conflicts = conflicts;
+    }
+
+    // Intercambia las columnas de dos filas y se queda con el cambio solo si reduce los conflictos
+
+    bool try_swap(int first, int second){
+
+        long long before = conflicts;
+
+        remove(first);
+        remove(second);
+        std::swap(queens[first], queens[second]);
+        add(first);
+        add(second);
+
+        if (conflicts < before){
+
+            return true;
+
+        }
+
+        remove(first);
+        remove(second);
+        std::swap(queens[first], queens[second]);
+        add(first);
+        add(second);
+
+        return false;
+    }
+
+    // Repara por rondas: cada reina en conflicto prueba intercambios aleatorios que reduzcan los
+    // conflictos. Si una ronda completa no mejora nada se reinicia desde otra permutación golosa
+
+    bool solve(){
+
+        iterations = 0;
+        swaps = 0;
+        restarts = 0;
+
+        long long max_iterations = std::max(MIN_REPAIR_STEPS, static_cast<long long>(REPAIR_STEPS_PER_QUEEN) * n);
+        std::uniform_int_distribution<int> pick(0, n - 1);
+        std::vector<int> conflicted;
+
+        while (iterations < max_iterations){
+
+            greedy_start();
+
+            bool progress = true;
+
+            while (conflicts > 0 && progress && iterations < max_iterations){
+
+                progress = false;
+                conflicted.clear();
+
+                for (int row = 0; row < n; row++){
+
+                    if (in_conflict(row)) conflicted.push_back(row);
+
+                }
+
+                for (int row : conflicted){
+
+                    for (int attempt = 0; attempt < n && in_conflict(row) && iterations < max_iterations; attempt++){
+
+                        iterations++;
+
+                        if (try_swap(row, pick(rng))){
+
+                            swaps++;
+                            progress = true;
+
+                        }
+                    }
+                }
+            }
+
+            if (conflicts == 0){
+
+                return true;
+
+            }
+
+            restarts++;
+        }
+
+        return conflicts == 0;
+    }
+};
+
+// Secuencia de Luby (1, 1, 2, 1, 1, 2, 4, 1, 1, 2, ...) para i >= 1. Multiplicada por LUBY_UNIT
+// da el presupuesto de nodos de cada reinicio
+
+inline long long luby(long long i){
+
+    int k = 1;
+
+    while ((1LL << k) - 1 < i){
+
+        k++;
+
+    }
+
+    if (i == (1LL << k) - 1){
+
+        return 1LL << (k - 1);
+
+    }
+
+    return luby(i - (1LL << (k - 1)) + 1);
+}
+
+// Búsqueda aleatoria independiente para la carrera entre hilos: el mismo esquema que
+// probabilistic_backtracking() pero con estado propio (máscaras de bits, generador y búferes de
+// columnas por fila), un presupuesto de nodos y una bandera compartida para detenerse cuando otro
+// hilo gana. Usa máscaras de 64 bits, así que admite hasta MAX_MASK_SIZE columnas
+
+template <typename Rng = Pcg32>
+struct RacingSearch{
+
+    int n;
+    Rng generator;
+    const std::atomic<bool>& stop;
+    long long nodes = 0;
+    long long budget = 0;
+    int queens[MAX_MASK_SIZE];
+    int candidates[MAX_MASK_SIZE][MAX_MASK_SIZE]; // Permutación de las columnas de cada fila
+
+    RacingSearch(int size, unsigned seed, uint64_t stream, const std::atomic<bool>& stop_flag) : n(size), generator(make_stream<Rng>(seed, stream)), stop(stop_flag){
+
+        for (int row = 0; row < n; row++){
+
+            std::iota(candidates[row], candidates[row] + n, 0);
+
+        }
+    }
+
+    bool search(int row, mask_t columns, mask_t diagonals, mask_t anti_diagonals){
+
+        if (row == n){
+
+            return true;
+
+        }
+
+        if (stop.load(std::memory_order_relaxed) || ++nodes > budget){
+
+            return false;
+
+        }
+
+        int* order = candidates[row];
+        int positions_to_check = std::max(1, static_cast<int>(n * PROBABILITY));
+        mask_t occupied = columns | diagonals | anti_diagonals;
+
+        for (int i = 0; i < positions_to_check; i++){
+
+            std::swap(order[i], order[i + uniform_below(generator, n - i)]); // Fisher-Yates parcial
+            mask_t bit = 1ULL << order[i];
+
+            if (!(occupied & bit)){
+
+                queens[row] = order[i];
+
+                if (search(row + 1, columns | bit, (diagonals | bit) << 1, (anti_diagonals | bit) >> 1)){
+
+                    return true;
+
+                }
+
+                if (nodes > budget){
+
+                    return false;
+
+                }
+            }
+        }
+
+        return false;
+    }
+};
+
+// Modo Las Vegas: cada hilo reinicia su búsqueda con presupuestos de Luby hasta encontrar una
+// solución. El primero en terminar levanta la bandera y copia su tablero en solution. Todos los
+// hilos usan la misma semilla; el flujo lleva first_stream en los 32 bits altos y el número de hilo
+// en los bajos, así que las secuencias son independientes entre hilos y entre carreras con distinto
+// first_stream. Con n fuera de [1, MAX_MASK_SIZE] solution queda vacía
+
+template <typename Rng = Pcg32>
+void parallel_racing(int n, int threads, unsigned seed, std::vector<int>& solution, unsigned first_stream = 0){
+
+    if (n < 1 || n > MAX_MASK_SIZE){
+
+        solution.clear();
+        return;
+
+    }
+
+    std::atomic<bool> stop(false);
+    std::vector<std::thread> pool;
+
+    solution.assign(n, 0);
+
+    for (int id = 0; id < threads; id++){
+
+        pool.emplace_back([&stop, &solution, n, seed, first_stream, id](){
+
+            RacingSearch<Rng> racer(n, seed, (static_cast<uint64_t>(first_stream) << 32) | id, stop);
+
+            for (long long restart = 1; !stop.load(std::memory_order_relaxed); restart++){
+
+                racer.nodes = 0;
+                racer.budget = LUBY_UNIT * luby(restart);
+
+                if (racer.search(0, 0, 0, 0)){
+
+                    if (!stop.exchange(true)){
+
+                        std::copy(racer.queens, racer.queens + n, solution.begin());
+
+                    }
+
+                    return;
+                }
+            }
+        });
+    }
+
+    for (std::thread& worker : pool){
+
+        worker.join();
+
+    }
+}
+
+#endif
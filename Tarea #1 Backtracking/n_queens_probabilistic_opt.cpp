@@ -2,216 +2,318 @@
 #include <chrono>
 #include <random>
 #include <algorithm>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <cmath>
+#include "n_queens_probabilistic.h"
+#include "n_queens_verify.h"
 using namespace std;
 using namespace std::chrono;
 
 const int BOARD_SIZE = 64;
-const double PROBABILITY = 0.3;
+const int LARGE_BOARD_SIZE = 1000000; // Tamaño usado para el solver de mínimos conflictos
 
-int board[BOARD_SIZE][BOARD_SIZE] = {0};
-bool solution_found = false;
-mt19937 rng(random_device{}()); // Generador de números pseudoaleatorios Mersenne Twister 19937
+// API por lotes: cada trabajo indica el tamaño del tablero y la estrategia. Los trabajos se reparten
+// entre los hilos con un contador atómico; cada trabajo crea su propio solver con la semilla del
+// lote y su índice como flujo, así que dos trabajos nunca comparten secuencia. LAS_VEGAS solo admite
+// N <= MAX_MASK_SIZE; para tableros más grandes el trabajo pasa a MIN_CONFLICTS y el resultado lo
+// indica en strategy
 
-/* void print_board(){
+enum Strategy{ PROBABILISTIC, LAS_VEGAS, MIN_CONFLICTS };
 
-    for (int i = 0; i < BOARD_SIZE; i++){
+struct BatchJob{
 
-        for (int j = 0; j < BOARD_SIZE; j++){
+    int n;
+    Strategy strategy;
 
-            if (board[i][j] < 0){
+};
 
-                cout << "Q" << -board[i][j] << " ";
-                
-            } else{
+struct BatchResult{
 
-                cout << ".  ";
-            }
-        }
-        cout << endl;
-    }
-} */
+    bool solved = false;
+    Strategy strategy = PROBABILISTIC; // Estrategia que resolvió el trabajo
+    vector<int> queens; // queens[fila] = columna
+    long long microseconds = 0;
 
-void check_box(int row, int column, int queen_ID, bool mark){
+};
 
-    for(int i = 0; i < BOARD_SIZE; i++){
+BatchResult solve_job(const BatchJob& job, unsigned seed, unsigned stream){
 
-        if (mark){
+    BatchResult result;
+    auto start = high_resolution_clock::now();
 
-            if(board[i][column] == 0){
+    result.strategy = (job.strategy == LAS_VEGAS && job.n > MAX_MASK_SIZE) ? MIN_CONFLICTS : job.strategy;
 
-                board[i][column] = queen_ID;
+    if (result.strategy == PROBABILISTIC){
 
-            }
+        ProbabilisticSolver<> solver(job.n, seed, stream);
+        solver.probabilistic_backtracking(0, 1);
+        result.solved = solver.solution_found;
+
+        if (result.solved){
+
+            result.queens.resize(job.n);
+
+            for (int row = 0; row < job.n; row++){
 
-        }else{
-            if(board[i][column] == queen_ID){
+                for (int column = 0; column < job.n; column++){
 
-                board[i][column] = 0;
+                    if (solver.board[row][column] < 0) result.queens[row] = column;
+
+                }
             }
         }
+
+    } else if (result.strategy == LAS_VEGAS){
+
+        parallel_racing(job.n, 1, seed, result.queens, stream); // El lote ya reparte los hilos
+        result.solved = valid_solution(result.queens);
+
+    } else{
+
+        MinConflictsSolver solver(job.n, seed, stream);
+        result.solved = solver.solve();
+        result.queens = solver.queens;
+
     }
 
-    for (int step = 1; step < BOARD_SIZE; step++){
+    auto stop = high_resolution_clock::now();
+    result.microseconds = duration_cast<microseconds>(stop - start).count();
+
+    return result;
+}
 
-        if (row + step < BOARD_SIZE && column + step < BOARD_SIZE){
+vector<BatchResult> solve_batch(const vector<BatchJob>& jobs, int threads, unsigned seed){
 
-            if (mark){
+    vector<BatchResult> results(jobs.size());
+    atomic<size_t> next_job(0);
+    vector<thread> pool;
 
-                if (board[row + step][column + step] == 0){
+    for (int id = 0; id < threads; id++){
 
-                    board[row + step][column + step] = queen_ID;
+        pool.emplace_back([&jobs, &results, &next_job, seed](){
 
-                }
-            } else{
+            for (size_t i = next_job++; i < jobs.size(); i = next_job++){
 
-                if (board[row + step][column + step] == queen_ID){
+                results[i] = solve_job(jobs[i], seed, static_cast<unsigned>(i));
 
-                    board[row + step][column + step] = 0;
-                }
             }
-        }
+        });
+    }
 
-        if(row - step >= 0 && column - step >= 0){
+    for (thread& worker : pool){
 
-            if (mark){
+        worker.join();
 
-                if (board[row - step][column - step] == 0){
+    }
 
-                    board[row - step][column - step] = queen_ID;
+    return results;
+}
 
-                }
-            }else{
+// Ciclo de medición compartido por todos los solvers: prepare() no se mide, solve() devuelve si
+// encontró solución
 
-                if (board[row - step][column - step] == queen_ID){
+template <typename Prepare, typename Solve>
+void run_benchmark(const string& name, int iterations, Prepare prepare, Solve solve){
 
-                    board[row - step][column - step] = 0;
+    long long total_microseconds = 0;
+    int solutions_found = 0;
+    vector<long long> durations;
 
-                }
-            }
+    for (int i = 0; i < iterations; i++){
+        prepare();
+        
+        auto start = high_resolution_clock::now();
+        bool solved = solve();
+        auto stop = high_resolution_clock::now();
+        
+        auto duration = duration_cast<microseconds>(stop - start);
+        total_microseconds += duration.count();
+        durations.push_back(duration.count());
+        
+        if (solved) {
+            solutions_found++;
         }
+    }
 
-        if(row + step < BOARD_SIZE && column - step >= 0){
+    double avg_microseconds = static_cast<double>(total_microseconds) / iterations;
+    double avg_milliseconds = avg_microseconds / 1000.0;
+    double success_rate = (static_cast<double>(solutions_found) / iterations) * 100.0;
 
-            if (mark){
+    cout << "=== " << name << " ===" << endl;
+    cout << "Total duration: " << total_microseconds << endl;
+    cout << "Solutions found: " << solutions_found << " (" << success_rate << "% success rate)" << endl;
+    cout << "Average execution time: " << avg_microseconds << " microseconds (" << avg_milliseconds << " milliseconds)" << endl;
 
-                if (board[row + step][column - step] == 0){
+    // Percentiles por rango más cercano del tiempo hasta la solución
 
-                    board[row + step][column - step] = queen_ID;
+    sort(durations.begin(), durations.end());
+    long long p50 = durations[(durations.size() * 50 + 99) / 100 - 1];
+    long long p99 = durations[(durations.size() * 99 + 99) / 100 - 1];
 
-                }
-            }else{
+    cout << "p50: " << p50 << " microseconds, p99: " << p99 << " microseconds" << endl;
+}
 
-                if (board[row + step][column - step] == queen_ID){
+// El mismo trabajo con cada generador: sorteos sueltos, el modo adaptativo y nodos de la búsqueda
+// de la carrera. Las dos búsquedas sortean una columna por cada hijo probado, así que la diferencia
+// de tiempo entre generadores es el costo de sortear
 
-                    board[row + step][column - step] = 0;
-                }
-            }
-        }
+template <typename Rng>
+void compare_engine(const string& name, int iterations, unsigned seed){
 
-        if (row - step >= 0 && column + step < BOARD_SIZE){
+    const int DRAWS = 100000000;
+    Rng rng = make_stream<Rng>(seed, 0);
+    unsigned long long checksum = 0;
 
-            if (mark){
+    auto start = high_resolution_clock::now();
+    for (int i = 0; i < DRAWS; i++){
 
-                if (board[row - step][column + step] == 0){
+        checksum += uniform_below(rng, BOARD_SIZE - i % BOARD_SIZE);
 
-                    board[row - step][column + step] = queen_ID;
+    }
+    auto stop = high_resolution_clock::now();
 
-                }
-            }else{
+    cout << name << ": " << static_cast<double>(duration_cast<nanoseconds>(stop - start).count()) / DRAWS << " ns per draw (checksum " << checksum << ")" << endl;
 
-                if (board[row - step][column + step] == queen_ID){
+    ProbabilisticSolver<Rng> adaptive_solver(BOARD_SIZE, seed);
 
-                    board[row - step][column + step] = 0;
-                }
-            }
-        }
-    }
+    run_benchmark("Adaptive probabilistic backtracking with " + name + " (N = " + to_string(BOARD_SIZE) + ")", iterations, [](){}, [&adaptive_solver](){
 
-    if (mark){
+        adaptive_solver.adaptive_solve();
+        return adaptive_solver.solution_found;
+    });
 
-        board[row][column] = -queen_ID;
+    // Búsqueda de la carrera con la misma cantidad de nodos para todos los generadores
 
-    } else{
+    const long long RACING_NODES = 50000000;
+    atomic<bool> never_stop(false);
+    RacingSearch<Rng> racer(BOARD_SIZE, seed, 0, never_stop);
+    long long total_nodes = 0;
 
-        board[row][column] = 0;
+    start = high_resolution_clock::now();
+    for (long long restart = 1; total_nodes < RACING_NODES; restart++){
+
+        racer.nodes = 0;
+        racer.budget = LUBY_UNIT * luby(restart);
+        racer.search(0, 0, 0, 0);
+        total_nodes += min(racer.nodes, racer.budget);
     }
+    stop = high_resolution_clock::now();
+
+    cout << "Racing search with " << name << ": " << static_cast<double>(duration_cast<nanoseconds>(stop - start).count()) / total_nodes << " ns per node" << endl;
 }
 
-void probabilistic_backtracking(int row, int queen_ID){
+int main(){
+
+    const int ITERATIONS = 10;
+    mt19937 seeds(random_device{}());
+    ProbabilisticSolver<> probabilistic_solver(BOARD_SIZE, seeds());
+
+    run_benchmark("Probabilistic backtracking (N = " + to_string(BOARD_SIZE) + ")", ITERATIONS, [&probabilistic_solver](){
+
+        probabilistic_solver.reset_board();
+    }, [&probabilistic_solver](){
+
+        SearchStats::timestamp solve_start = probabilistic_solver.stats.start_timer();
+        probabilistic_solver.probabilistic_backtracking(0, 1);
+        probabilistic_solver.stats.stop_solve(solve_start);
+        return probabilistic_solver.solution_found;
+    });
+
+    // Contadores acumulados de todas las iteraciones (solo con -DNQ_STATS)
 
-    if (solution_found) return;
+    probabilistic_solver.stats.report("probabilistic backtracking, " + to_string(ITERATIONS) + " runs");
 
-    if (row == BOARD_SIZE){
+    if (probabilistic_solver.stats.export_csv("n_queens_probabilistic_opt_stats.csv")){
 
-        solution_found = true;
-        // print_board();
-        return;
+        cout << "Per-row histogram written to n_queens_probabilistic_opt_stats.csv" << endl;
 
     }
 
-    vector<int> columns(BOARD_SIZE);
-    iota(columns.begin(), columns.end(), 0);
-    shuffle(columns.begin(), columns.end(), rng);
+    ProbabilisticSolver<> adaptive_solver(BOARD_SIZE, seeds());
+    int adaptive_attempts = 0;
 
-    int positions_to_check = max(1, static_cast<int>(BOARD_SIZE * PROBABILITY));
+    run_benchmark("Adaptive probabilistic backtracking (N = " + to_string(BOARD_SIZE) + ")", ITERATIONS, [](){}, [&adaptive_solver, &adaptive_attempts](){
 
-    for (int i = 0; i < positions_to_check; i++){
+        adaptive_attempts += adaptive_solver.adaptive_solve();
+        return adaptive_solver.solution_found;
+    });
 
-        int column = columns[i];
+    cout << "Attempts per solve: " << static_cast<double>(adaptive_attempts) / ITERATIONS << endl;
 
-        if (board[row][column] == 0){
+    // Comparación de generadores
 
-            check_box(row, column, queen_ID, true);
+    const int ENGINE_ITERATIONS = 100;
+    unsigned engine_seed = seeds();
 
-            probabilistic_backtracking(row + 1, queen_ID + 1);
+    compare_engine<mt19937>("mt19937", ENGINE_ITERATIONS, engine_seed);
+    compare_engine<Pcg32>("PCG32", ENGINE_ITERATIONS, engine_seed);
+    compare_engine<Xoshiro128>("xoshiro128**", ENGINE_ITERATIONS, engine_seed);
 
-            if (solution_found) return;
+    int threads = max(1u, thread::hardware_concurrency());
+    vector<int> racing_solution;
 
-            check_box(row, column, queen_ID, false);
-        }
-    }
-}
+    run_benchmark("Parallel racing with Luby restarts (N = " + to_string(BOARD_SIZE) + ", " + to_string(threads) + " threads)", ITERATIONS, [](){}, [threads, &seeds, &racing_solution](){
+
+        parallel_racing(BOARD_SIZE, threads, seeds(), racing_solution);
+        return valid_solution(racing_solution);
+    });
+
+    MinConflictsSolver small_solver(BOARD_SIZE, seeds());
+
+    run_benchmark("Min-conflicts (N = " + to_string(BOARD_SIZE) + ")", ITERATIONS, [](){}, [&small_solver](){
+
+        return small_solver.solve();
+    });
+
+    MinConflictsSolver large_solver(LARGE_BOARD_SIZE, seeds());
+
+    run_benchmark("Min-conflicts (N = " + to_string(LARGE_BOARD_SIZE) + ")", ITERATIONS, [](){}, [&large_solver](){
+
+        return large_solver.solve();
+    });
+
+    cout << "Last large run: " << large_solver.initial_conflicts << " conflicts after greedy start, "
+         << large_solver.iterations << " repair iterations, " << large_solver.swaps << " swaps, " << large_solver.restarts << " restarts" << endl;
+
+    // Lote de trabajos mezclando tamaños y estrategias, con un hilo y con todos los disponibles
 
+    const int BATCH_REPEATS = 10;
+    vector<BatchJob> jobs;
 
-void reset_board(){
+    for (int repeat = 0; repeat < BATCH_REPEATS; repeat++){
 
-    solution_found = false;
+        for (int n = 8; n <= 20; n++){
 
-    for (int i = 0; i < BOARD_SIZE; i++) {
-        for (int j = 0; j < BOARD_SIZE; j++) {
-            board[i][j] = 0;
+            jobs.push_back({n, LAS_VEGAS});
+            jobs.push_back({n * 1000, MIN_CONFLICTS});
         }
+
+        jobs.push_back({20, PROBABILISTIC}); // Con tableros más chicos casi nunca encuentra solución
     }
-}
 
-int main(){
+    unsigned batch_seed = seeds();
 
-    const int ITERATIONS = 10;
-    long long total_microseconds = 0;
-    int solutions_found = 0;
+    for (int pool_size : {1, threads}){
 
-    for (int i = 0; i < ITERATIONS; i++){
-        reset_board();
-        
         auto start = high_resolution_clock::now();
-        probabilistic_backtracking(0, 1);
+        vector<BatchResult> results = solve_batch(jobs, pool_size, batch_seed);
         auto stop = high_resolution_clock::now();
-        
-        auto duration = duration_cast<microseconds>(stop - start);
-        total_microseconds += duration.count();
-        
-        if (solution_found) {
-            solutions_found++;
-        }
-    }
+        double seconds = duration_cast<microseconds>(stop - start).count() / 1e6;
 
-    double avg_microseconds = static_cast<double>(total_microseconds) / ITERATIONS;
-    double avg_milliseconds = avg_microseconds / 1000.0;
-    double success_rate = (static_cast<double>(solutions_found) / ITERATIONS) * 100.0;
+        int solved = 0;
 
-    cout << "Total duration: " << total_microseconds << endl;
-    cout << "Solutions found: " << solutions_found << " (" << success_rate << "% success rate)" << endl;
-    cout << "Average execution time: " << avg_microseconds << " microseconds (" << avg_milliseconds << " milliseconds)" << endl;
+        for (const BatchResult& result : results){
+
+            if (result.solved) solved++;
+
+        }
+
+        cout << "Batch of " << jobs.size() << " jobs on " << pool_size << " threads: " << solved << " solved in " << seconds
+             << " seconds (" << jobs.size() / seconds << " jobs/second)" << endl;
+    }
     
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,343 @@
+#ifndef N_QUEENS_ROW_H
+#define N_QUEENS_ROW_H
+
+// Motores por filas de n_queens_row_opt.cpp: backtracking() sobre un tablero de enteros y su versión
+// con máscaras de bits. Los usan n_queens_row_opt.cpp, n_queens_benchmark.cpp y, como referencia,
+// n_queens_bitset.cpp, n_queens_dlx.cpp, n_queens_mrv.cpp y n_queens_table.cpp
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+#include "n_queens_stats.h"
+
+typedef unsigned long long mask_t;
+
+const int MAX_MASK_SIZE = 64; // BitmaskSolver guarda cada fila en una sola palabra de 64 bits
+
+// Solver original con tablero de enteros. Todo el estado vive en el objeto, así que varios
+// solvers pueden trabajar a la vez en hilos distintos
+
+struct RowSolver{
+
+    int n;
+    std::vector<std::vector<int>> board;
+    std::vector<int> queen_column; // Columna de la reina colocada en cada fila
+    std::vector<int> first_solution; // Copia de queen_column al encontrar la primera solución
+    bool solution_found = false;
+    long long nodes = 0; // Reinas colocadas
+    SearchStats stats; // Vacío salvo que se compile con -DNQ_STATS
+
+    RowSolver(int size) : n(size), board(size, std::vector<int>(size, 0)), queen_column(size), first_solution(size){ stats.reset(size); }
+
+    /* void print_board(){
+
+        for (int i = 0; i < n; i++){
+
+            for (int j = 0; j < n; j++){
+
+                if (board[i][j] < 0){
+
+                    std::cout << "Q" << -board[i][j] << " "; // Imprime la reina con su ID
+
+                } else{
+
+                    std::cout << ".  "; // Imprime casilla vacía
+
+                }
+            }
+
+            std::cout << std::endl;
+
+        }
+    } */
+
+    void check_box(int row, int column, int queen_ID, bool mark){
+
+        SearchStats::timestamp start = stats.start_timer();
+        stats.mark(mark);
+
+        for(int i = 0; i < n; i++){
+
+            if (mark){
+
+                if(board[i][column] == 0){
+
+                    board[i][column] = queen_ID; // Marca toda la columna como ocupada por la reina
+
+                }
+
+            }else{
+
+                if(board[i][column] == queen_ID){
+
+                    board[i][column] = 0; // Desmarca toda la columna como ocupada por la reina si se devuelve
+                }
+            }
+        }
+
+        // Marca las diagonales ocupadas por la reina
+
+        for (int step = 1; step < n; step++){
+
+            if (row + step < n && column + step < n){
+
+                if (mark){
+
+                    if (board[row + step][column + step] == 0){
+
+                        board[row + step][column + step] = queen_ID;
+
+                    }
+
+                }else{
+
+                    if (board[row + step][column + step] == queen_ID){
+
+                        board[row + step][column + step] = 0;
+                    }
+                }
+            }
+
+            if(row - step >= 0 && column - step >= 0){
+
+                if (mark){
+
+                    if (board[row - step][column - step] == 0){
+
+                        board[row - step][column - step] = queen_ID;
+
+                    }
+
+                }else{
+
+                    if (board[row - step][column - step] == queen_ID){
+
+                        board[row - step][column - step] = 0;
+                    }
+                }
+            }
+
+            if(row + step < n && column - step >= 0){
+
+                if (mark){
+
+                    if (board[row + step][column - step] == 0){
+
+                        board[row + step][column - step] = queen_ID;
+
+                    }
+
+                }else{
+
+                    if (board[row + step][column - step] == queen_ID){
+
+                        board[row + step][column - step] = 0;
+                    }
+                }
+            }
+
+            if (row - step >= 0 && column + step < n){
+
+                if (mark){
+
+                    if (board[row - step][column + step] == 0){
+
+                        board[row - step][column + step] = queen_ID;
+
+                    }
+
+                }else{
+
+                    if (board[row - step][column + step] == queen_ID){
+
+                        board[row - step][column + step] = 0;
+                    }
+                }
+            }
+        }
+
+        if (mark){
+
+            board[row][column] = -queen_ID; 
+
+        }else{
+
+            board[row][column] = 0; 
+
+        }
+
+        stats.stop_marking(start);
+    }
+
+    void backtracking(int row, int queen_ID){
+
+        if (solution_found){
+
+            return;
+
+        }
+
+        stats.node(row);
+
+        if (row == n){
+
+            solution_found = true; 
+            first_solution = queen_column;
+            // print_board(); 
+            return;
+
+        }
+
+        bool placed = false;
+
+        for (int column = 0; column < n; column++){
+
+            stats.check();
+
+            if (board[row][column] == 0){
+
+                queen_column[row] = column;
+                placed = true;
+                nodes++;
+                stats.branch(row);
+
+                check_box(row, column, queen_ID, true); // Marca la posición de la reina y las casillas ocupadas
+
+                backtracking(row + 1, queen_ID + 1); // Llama a la función recursiva para la siguiente fila
+
+                stats.backtrack(row);
+                check_box(row, column, queen_ID, false); // Desmarca la posición de la reina y las casillas ocupadas
+            }
+        }
+
+        if (!placed){
+
+            stats.dead_end(row);
+
+        }
+    }
+
+    void reset_board(){
+
+        for (int i = 0; i < n; i++) {
+            std::fill(board[i].begin(), board[i].end(), 0);
+        }
+        solution_found = false;
+        nodes = 0;
+    }
+};
+
+// Motor con máscaras de bits: cada bit i representa la columna i de la fila actual.
+// Versión con máscaras de bits de backtracking(): las columnas y ambas diagonales ocupadas se
+// pasan por valor, así que colocar y deshacer una reina cuesta O(1). Las columnas libres se recorren
+// de menor a mayor (bit menos significativo), por lo que la primera solución es la misma que la de
+// backtracking(). Con más de MAX_MASK_SIZE columnas el tablero no cabe: valid queda en false, full
+// en 0 y la búsqueda termina sin solución en la primera fila. Con node_limit la búsqueda se corta al
+// llegar a esa cantidad de reinas colocadas y stopped queda en true
+//
+// bitmask_backtracking<true>() agrega la comprobación hacia adelante: después de cada colocación
+// revisa las filas restantes (la fila k más abajo ve las diagonales desplazadas k lugares) y descarta
+// la reina si alguna se quedó sin columnas libres. El árbol explorado es un subconjunto del original
+// y la primera solución es la misma
+
+struct BitmaskSolver{
+
+    int n;
+    bool valid;
+    mask_t full;
+    std::vector<int> queen_column;
+    bool solution_found = false;
+    bool stopped = false; // Se agotó node_limit
+    long long nodes = 0; // Reinas colocadas
+    long long node_limit = -1; // Presupuesto de nodos (-1 sin límite)
+    long long pruned = 0; // Colocaciones descartadas por la comprobación hacia adelante
+    SearchStats stats;
+
+    BitmaskSolver(int size) : n(size), valid(size <= MAX_MASK_SIZE),
+        full(!valid ? 0 : (size == 64 ? ~0ULL : ((1ULL << size) - 1))), queen_column(valid ? size : 0){ stats.reset(valid ? size : 0); }
+
+    // true si alguna fila desde row hasta n - 1 no tiene columnas libres con las máscaras de la fila row
+
+    bool blocked_ahead(int row, mask_t columns, mask_t diagonals, mask_t anti_diagonals) const{
+
+        for (int k = 0; row + k < n; k++){
+
+            if (!(~(columns | (diagonals << k) | (anti_diagonals >> k)) & full)){
+
+                return true;
+
+            }
+        }
+
+        return false;
+    }
+
+    template <bool FORWARD_CHECKING = false>
+    void bitmask_backtracking(int row, mask_t columns, mask_t diagonals, mask_t anti_diagonals){
+
+        if (solution_found){
+
+            return;
+
+        }
+
+        stats.node(row);
+
+        if (row == n){
+
+            solution_found = true;
+            return;
+
+        }
+
+        mask_t free_columns = ~(columns | diagonals | anti_diagonals) & full;
+
+        if (!free_columns){
+
+            stats.dead_end(row);
+
+        }
+
+        while (free_columns){
+
+            if (nodes == node_limit){
+
+                stopped = true;
+                return;
+
+            }
+
+            mask_t bit = free_columns & (~free_columns + 1); // Bit libre menos significativo
+            int column = __builtin_ctzll(bit);
+
+            queen_column[row] = column;
+            nodes++;
+            stats.branch(row);
+
+            // La diagonal descendente avanza una columna a la derecha por fila y la ascendente una a la izquierda
+            mask_t next_columns = columns | bit;
+            mask_t next_diagonals = ((diagonals | bit) << 1) & full;
+            mask_t next_anti_diagonals = (anti_diagonals | bit) >> 1;
+
+            if (FORWARD_CHECKING && blocked_ahead(row + 1, next_columns, next_diagonals, next_anti_diagonals)){
+
+                pruned++;
+
+            } else{
+
+                bitmask_backtracking<FORWARD_CHECKING>(row + 1, next_columns, next_diagonals, next_anti_diagonals);
+
+                if (solution_found || stopped){
+
+                    return;
+
+                }
+            }
+
+            stats.backtrack(row);
+            free_columns &= free_columns - 1; // Descarta la columna ya probada
+        }
+    }
+};
+
+#endif
@@ -1,215 +1,191 @@
 #include <iostream>
 #include <chrono>
+#include <algorithm>
+#include <vector>
+#include <string>
+#include <thread>
+#include <atomic>
+#include "n_queens_row.h"
 using namespace std;
 using namespace std::chrono;
 
 const int BOARD_SIZE = 32;
 
-int board[BOARD_SIZE][BOARD_SIZE] = {0};
+// API por lotes: cada trabajo indica el tamaño del tablero y la estrategia. Los trabajos se reparten
+// entre los hilos con un contador atómico y cada uno usa su propio objeto solver. BITMASK solo admite
+// N <= 64; para tableros más grandes el trabajo pasa a BACKTRACKING (misma primera solución) y el
+// resultado lo indica en strategy
 
-bool solution_found = false;
+enum Strategy{ BACKTRACKING, BITMASK };
 
-/* void print_board(){
+struct BatchJob{
 
-    for (int i = 0; i < BOARD_SIZE; i++){
+    int n;
+    Strategy strategy;
 
-        for (int j = 0; j < BOARD_SIZE; j++){
+};
 
-            if (board[i][j] < 0){
+struct BatchResult{
 
-                cout << "Q" << -board[i][j] << " "; // Imprime la reina con su ID
+    bool solved = false;
+    Strategy strategy = BACKTRACKING; // Estrategia que resolvió el trabajo
+    vector<int> queens; // queens[fila] = columna de la primera solución
+    long long microseconds = 0;
 
-            } else{
+};
 
-                cout << ".  "; // Imprime casilla vacía
-
-            }
-        }
-
-        cout << endl;
-
-    }
-} */ 
+BatchResult solve_job(const BatchJob& job){
 
+    BatchResult result;
+    auto start = high_resolution_clock::now();
 
-void check_box(int row, int column, int queen_ID, bool mark){
+    result.strategy = (job.strategy == BITMASK && job.n <= MAX_MASK_SIZE) ? BITMASK : BACKTRACKING;
 
-    for(int i = 0; i < BOARD_SIZE; i++){
+    if (result.strategy == BACKTRACKING){
 
-        if (mark){
+        RowSolver solver(job.n);
+        solver.backtracking(0, 1);
+        result.solved = solver.solution_found;
+        result.queens = solver.first_solution;
 
-            if(board[i][column] == 0){
+    } else{
 
-                board[i][column] = queen_ID; // Marca toda la columna como ocupada por la reina
+        BitmaskSolver solver(job.n);
+        solver.bitmask_backtracking(0, 0, 0, 0);
+        result.solved = solver.solution_found;
+        result.queens = solver.queen_column;
 
-            }
-
-        }else{
-
-            if(board[i][column] == queen_ID){
-
-                board[i][column] = 0; // Desmarca toda la columna como ocupada por la reina si se devuelve
-            }
-        }
     }
 
-    // Marca las diagonales ocupadas por la reina
-
-    for (int step = 1; step < BOARD_SIZE; step++){
-
-        if (row + step < BOARD_SIZE && column + step < BOARD_SIZE){
-
-            if (mark){
-
-                if (board[row + step][column + step] == 0){
-
-                    board[row + step][column + step] = queen_ID;
-
-                }
-
-            }else{
-
-                if (board[row + step][column + step] == queen_ID){
-
-                    board[row + step][column + step] = 0;
-                }
-            }
-        }
+    auto stop = high_resolution_clock::now();
+    result.microseconds = duration_cast<microseconds>(stop - start).count();
 
-        if(row - step >= 0 && column - step >= 0){
+    return result;
+}
 
-            if (mark){
+vector<BatchResult> solve_batch(const vector<BatchJob>& jobs, int threads){
 
-                if (board[row - step][column - step] == 0){
+    vector<BatchResult> results(jobs.size());
+    atomic<size_t> next_job(0);
+    vector<thread> pool;
 
-                    board[row - step][column - step] = queen_ID;
+    for (int id = 0; id < threads; id++){
 
-                }
+        pool.emplace_back([&jobs, &results, &next_job](){
 
-            }else{
+            for (size_t i = next_job++; i < jobs.size(); i = next_job++){
 
-                if (board[row - step][column - step] == queen_ID){
+                results[i] = solve_job(jobs[i]);
 
-                    board[row - step][column - step] = 0;
-                }
             }
-        }
-
-        if(row + step < BOARD_SIZE && column - step >= 0){
-
-            if (mark){
-
-                if (board[row + step][column - step] == 0){
+        });
+    }
 
-                    board[row + step][column - step] = queen_ID;
+    for (thread& worker : pool){
 
-                }
+        worker.join();
 
-            }else{
+    }
 
-                if (board[row + step][column - step] == queen_ID){
+    return results;
+}
 
-                    board[row + step][column - step] = 0;
-                }
-            }
-        }
+int main(){
 
-        if (row - step >= 0 && column + step < BOARD_SIZE){
+    const int ITERATIONS = 50;
+    long long total_duration = 0;
+    RowSolver row_solver(BOARD_SIZE);
+    
+    for (int i = 0; i < ITERATIONS; i++) {
+        row_solver.reset_board();
+        
+        SearchStats::timestamp solve_start = row_solver.stats.start_timer();
+        auto start = high_resolution_clock::now();
+        row_solver.backtracking(0, 1);
+        auto stop = high_resolution_clock::now();
+        row_solver.stats.stop_solve(solve_start);
+        auto duration = duration_cast<microseconds>(stop - start);
+        
+        total_duration += duration.count();
+    }
+    
+    double average_duration = static_cast<double>(total_duration) / ITERATIONS;
+    
+    cout << "Total execution time for " << ITERATIONS << " iterations: " << total_duration << " microseconds" << endl;
+    cout << "Average execution time: " << average_duration << " microseconds" << endl;
+    cout << "Average execution time: " << average_duration/1000 << " milliseconds" << endl;
 
-            if (mark){
+    long long total_bitmask_duration = 0;
+    BitmaskSolver bitmask_solver(BOARD_SIZE);
 
-                if (board[row - step][column + step] == 0){
+    for (int i = 0; i < ITERATIONS; i++) {
+        bitmask_solver.solution_found = false;
 
-                    board[row - step][column + step] = queen_ID;
+        SearchStats::timestamp solve_start = bitmask_solver.stats.start_timer();
+        auto start = high_resolution_clock::now();
+        bitmask_solver.bitmask_backtracking(0, 0, 0, 0);
+        auto stop = high_resolution_clock::now();
+        bitmask_solver.stats.stop_solve(solve_start);
+        auto duration = duration_cast<nanoseconds>(stop - start);
 
-                }
+        total_bitmask_duration += duration.count();
+    }
 
-            }else{
+    bool same_solution = row_solver.first_solution == bitmask_solver.queen_column;
 
-                if (board[row - step][column + step] == queen_ID){
+    double average_bitmask_duration = static_cast<double>(total_bitmask_duration) / ITERATIONS / 1000.0;
 
-                    board[row - step][column + step] = 0;
-                }
-            }
-        }
-    }
+    cout << "Bitmask average execution time: " << average_bitmask_duration << " microseconds" << endl;
+    cout << "Bitmask speedup: " << average_duration / average_bitmask_duration << "x" << endl;
+    cout << "Same first solution as backtracking: " << (same_solution ? "yes" : "no") << endl;
 
-    if (mark){
+    // Contadores acumulados de todas las iteraciones (solo con -DNQ_STATS)
 
-        board[row][column] = -queen_ID; 
+    row_solver.stats.report("backtracking, " + to_string(ITERATIONS) + " runs");
+    bitmask_solver.stats.report("bitmask, " + to_string(ITERATIONS) + " runs");
 
-    }else{
+    if (row_solver.stats.export_csv("n_queens_row_opt_stats.csv") && bitmask_solver.stats.export_csv("n_queens_bitmask_stats.csv")){
 
-        board[row][column] = 0; 
+        cout << "Per-row histograms written to n_queens_row_opt_stats.csv and n_queens_bitmask_stats.csv" << endl;
 
     }
-}
-
-void backtracking(int row, int queen_ID){
-
-    if (solution_found){
 
-        return;
+    // Lote de trabajos mezclando tamaños y estrategias, con un hilo y con todos los disponibles
 
-    }
+    const int BATCH_REPEATS = 20;
+    const int BATCH_MAX_N = 20;
+    vector<BatchJob> jobs;
 
-    if (row == BOARD_SIZE){
+    for (int repeat = 0; repeat < BATCH_REPEATS; repeat++){
 
-        solution_found = true; 
-        // print_board(); 
-        return;
+        for (int n = 4; n <= BATCH_MAX_N; n++){
 
+            jobs.push_back({n, BACKTRACKING});
+            jobs.push_back({n, BITMASK});
+        }
     }
 
-    for (int column = 0; column < BOARD_SIZE; column++){
+    int threads = max(1u, thread::hardware_concurrency());
 
-        if (board[row][column] == 0){
+    for (int pool_size : {1, threads}){
 
-            check_box(row, column, queen_ID, true); // Marca la posición de la reina y las casillas ocupadas
+        auto start = high_resolution_clock::now();
+        vector<BatchResult> results = solve_batch(jobs, pool_size);
+        auto stop = high_resolution_clock::now();
+        double seconds = duration_cast<microseconds>(stop - start).count() / 1e6;
 
-            backtracking(row + 1, queen_ID + 1); // Llama a la función recursiva para la siguiente fila
+        int solved = 0;
 
-            check_box(row, column, queen_ID, false); // Desmarca la posición de la reina y las casillas ocupadas
-        }
-    }
-}
+        for (const BatchResult& result : results){
 
-void reset_board(){
+            if (result.solved) solved++;
 
-    for (int i = 0; i < BOARD_SIZE; i++) {
-        for (int j = 0; j < BOARD_SIZE; j++) {
-            board[i][j] = 0;
         }
-    }
-    solution_found = false;
-}
-
-int main(){
 
-    const int ITERATIONS = 50;
-    long long total_duration = 0;
-    
-    for (int i = 0; i < ITERATIONS; i++) {
-        reset_board();
-        
-        auto start = high_resolution_clock::now();
-        backtracking(0, 1);
-        auto stop = high_resolution_clock::now();
-        auto duration = duration_cast<microseconds>(stop - start);
-        
-        total_duration += duration.count();
+        cout << "Batch of " << jobs.size() << " jobs on " << pool_size << " threads: " << solved << " solved in " << seconds
+             << " seconds (" << jobs.size() / seconds << " jobs/second)" << endl;
     }
-    
-    double average_duration = static_cast<double>(total_duration) / ITERATIONS;
-    
-    cout << "Total execution time for " << ITERATIONS << " iterations: " << total_duration << " microseconds" << endl;
-    cout << "Average execution time: " << average_duration << " microseconds" << endl;
-    cout << "Average execution time: " << average_duration/1000 << " milliseconds" << endl;
 
-    
     return 0;
     
 }
-
-
-
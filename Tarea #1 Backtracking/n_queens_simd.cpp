@@ -0,0 +1,71 @@
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+#include <vector>
+#include "n_queens_simd.h"
+using namespace std;
+using namespace std::chrono;
+
+int main(){
+
+    const int INSTANCES = 200000;
+    const int MIN_N = 4;
+    const int MAX_FIXED = 3;
+    mt19937 rng(123456789);
+
+    vector<SmallInstance> instances;
+    uniform_int_distribution<int> board_size(MIN_N, MAX_SMALL_N);
+    uniform_int_distribution<int> fixed_count(0, MAX_FIXED);
+
+    for (int i = 0; i < INSTANCES; i++){
+
+        int n = board_size(rng);
+        instances.push_back({n, random_placement(n, fixed_count(rng), rng)});
+    }
+
+    instances.push_back({8, {{0, 0}, {1, 1}}}); // Reinas fijas que se atacan
+    instances.push_back({17, {}}); // Fuera del rango de los carriles
+    instances.push_back({3, {}}); // Sin solución
+
+    // Referencia: backtracking() una instancia tras otra
+
+    auto start = high_resolution_clock::now();
+    vector<SmallResult> expected;
+
+    for (const SmallInstance& instance : instances){
+
+        expected.push_back(solve_scalar(instance));
+
+    }
+
+    auto middle = high_resolution_clock::now();
+    long long steps = 0;
+    vector<SmallResult> results = solve_lanes(instances, &steps);
+    auto stop = high_resolution_clock::now();
+
+    int mismatches = 0;
+    int counts[3] = {0, 0, 0};
+
+    for (size_t i = 0; i < instances.size(); i++){
+
+        if (results[i].status != expected[i].status || results[i].queens != expected[i].queens) mismatches++;
+
+        counts[results[i].status]++;
+    }
+
+    double scalar_seconds = duration_cast<microseconds>(middle - start).count() / 1e6;
+    double lane_seconds = duration_cast<microseconds>(stop - middle).count() / 1e6;
+
+    cout << instances.size() << " instances (N = " << MIN_N << ".." << MAX_SMALL_N << ", up to " << MAX_FIXED << " fixed queens): "
+         << counts[COMPLETED] << " " << COMPLETION_STATUS_NAMES[COMPLETED] << ", " << counts[NO_COMPLETION] << " " << COMPLETION_STATUS_NAMES[NO_COMPLETION] << ", "
+         << counts[INVALID_PLACEMENT] << " " << COMPLETION_STATUS_NAMES[INVALID_PLACEMENT] << ", " << mismatches << " mismatches" << endl;
+    cout << "Scalar backtracking(): " << instances.size() / scalar_seconds << " instances/second" << endl;
+    cout << LANES << " SIMD lanes: " << instances.size() / lane_seconds << " instances/second (" << scalar_seconds / lane_seconds
+         << "x), " << steps << " steps" << endl;
+
+    return 0;
+}
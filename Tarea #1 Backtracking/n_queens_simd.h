@@ -0,0 +1,355 @@
+#ifndef N_QUEENS_SIMD_H
+#define N_QUEENS_SIMD_H
+
+// Motores de n_queens_simd.cpp: la referencia escalar y la búsqueda por carriles SIMD sobre
+// instancias de completado pequeñas. Lo usan n_queens_simd.cpp y n_queens_benchmark.cpp
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+#include <vector>
+#include "n_queens_completion.h"
+
+// Búsqueda de muchos tableros pequeños en paralelo por carriles SIMD. Con las extensiones de
+// vectores de GCC cada operación sobre lanes_t se aplica a los LANES carriles a la vez. La cantidad
+// de carriles es la de un registro del procesador destino: 4 con SSE2 (lo que usa -O2 por defecto),
+// 8 con -mavx2 y 16 con AVX-512 (-march=native en un procesador que lo tenga). Con vectores más
+// anchos que el registro el compilador los parte en memoria y la versión por carriles pierde
+
+typedef uint32_t lane_t; // Las diagonales se guardan sin recortar (ver LaneSolver) y ocupan hasta 32 bits
+
+const int MAX_SMALL_N = 16;
+
+#if defined(__AVX512F__)
+const int LANES = 16;
+#elif defined(__AVX2__)
+const int LANES = 8;
+#else
+const int LANES = 4;
+#endif
+
+typedef lane_t lanes_t __attribute__((vector_size(LANES * sizeof(lane_t))));
+
+// Instancia: tablero de n x n con algunas reinas fijas (fila, columna)
+
+struct SmallInstance{
+
+    int n;
+    std::vector<std::pair<int, int>> fixed;
+
+};
+
+// Los estados son los de n_queens_completion.h: COMPLETED, NO_COMPLETION o INVALID_PLACEMENT
+
+struct SmallResult{
+
+    CompletionStatus status = INVALID_PLACEMENT;
+    std::vector<int> queens; // queens[fila] = columna, solo si status == COMPLETED
+
+};
+
+// Las reinas fijas se traducen a una máscara de columnas permitidas por fila: en una fila fija solo
+// su columna, y en las demás todo lo que no atacan las reinas fijas. Así la búsqueda fila por fila
+// con máscaras que se corren no necesita saber nada más de las restricciones. allowed[n] queda en 0.
+// Devuelve false si la instancia no es válida (fuera del tablero o reinas fijas que se atacan)
+
+inline bool prepare(const SmallInstance& instance, lane_t allowed[MAX_SMALL_N + 1]){
+
+    int n = instance.n;
+
+    if (n < 1 || n > MAX_SMALL_N){
+
+        return false;
+
+    }
+
+    lane_t full = static_cast<lane_t>((1u << n) - 1);
+
+    for (int row = 0; row <= MAX_SMALL_N; row++){
+
+        allowed[row] = row < n ? full : 0;
+
+    }
+
+    for (const std::pair<int, int>& queen : instance.fixed){
+
+        int fixed_row = queen.first;
+        int fixed_column = queen.second;
+
+        if (fixed_row < 0 || fixed_row >= n || fixed_column < 0 || fixed_column >= n){
+
+            return false;
+
+        }
+
+        for (int row = 0; row < n; row++){
+
+            if (row == fixed_row){
+
+                if (!(allowed[row] >> fixed_column & 1)){
+
+                    return false; // Otra reina fija ya ocupa esta fila o ataca esta casilla
+
+                }
+
+                allowed[row] = static_cast<lane_t>(1u << fixed_column);
+                continue;
+            }
+
+            int distance = std::abs(row - fixed_row);
+            unsigned attacked = 1u << fixed_column;
+
+            if (fixed_column + distance < n) attacked |= 1u << (fixed_column + distance);
+            if (fixed_column - distance >= 0) attacked |= 1u << (fixed_column - distance);
+
+            allowed[row] &= static_cast<lane_t>(~attacked);
+        }
+    }
+
+    return true;
+}
+
+// Referencia escalar: el backtracking() por máscaras de bits de n_queens_row_opt.cpp restringido
+// por las máscaras permitidas, una instancia a la vez
+
+inline bool backtracking(int row, int n, unsigned full, const lane_t* allowed, unsigned columns, unsigned diagonals, unsigned anti_diagonals, std::vector<int>& queens){
+
+    if (row == n){
+
+        return true;
+
+    }
+
+    unsigned free_columns = ~(columns | diagonals | anti_diagonals) & allowed[row];
+
+    while (free_columns){
+
+        unsigned bit = free_columns & (~free_columns + 1);
+        queens[row] = __builtin_ctz(bit);
+
+        if (backtracking(row + 1, n, full, allowed, columns | bit, ((diagonals | bit) << 1) & full, (anti_diagonals | bit) >> 1, queens)){
+
+            return true;
+
+        }
+
+        free_columns &= free_columns - 1;
+    }
+
+    return false;
+}
+
+inline SmallResult solve_scalar(const SmallInstance& instance){
+
+    SmallResult result;
+    lane_t allowed[MAX_SMALL_N + 1];
+
+    if (!prepare(instance, allowed)){
+
+        return result;
+
+    }
+
+    result.queens.resize(instance.n);
+
+    if (backtracking(0, instance.n, (1u << instance.n) - 1, allowed, 0, 0, 0, result.queens)){
+
+        result.status = COMPLETED;
+
+    } else{
+
+        result.status = NO_COMPLETION;
+        result.queens.clear();
+
+    }
+
+    return result;
+}
+
+inline bool any_lane(const lanes_t& mask){
+
+    uint64_t words[sizeof(lanes_t) / sizeof(uint64_t)];
+    std::memcpy(words, &mask, sizeof(lanes_t));
+
+    uint64_t combined = 0;
+
+    for (uint64_t word : words){
+
+        combined |= word;
+
+    }
+
+    return combined != 0;
+}
+
+// Búsqueda por carriles: cada carril es la pila de una instancia distinta y en cada paso todos los
+// carriles avanzan a la vez. Un paso es igual para todos, sin saltos que dependan del carril: se toma
+// el bit libre más bajo, se calculan tanto el hijo como el padre guardado en la pila y se elige con
+// la máscara has (carriles con alguna columna libre). Solo guardar y leer la pila y la máscara
+// permitida de la fila siguiente dependen de la profundidad de cada carril, y eso se hace carril por
+// carril. Cuando un carril termina (solución o pila vacía) se anota el resultado y se carga la
+// siguiente instancia en ese carril, así ningún carril queda ocioso mientras queden instancias.
+//
+// Para que ese trabajo por carril sea mínimo, la pila guarda solo las columnas por probar y el bit
+// elegido en cada fila, juntos en 32 bits. Las máscaras del padre se recuperan deshaciendo el paso:
+// las diagonales no se recortan a n bits (la descendente crece hacia arriba y la ascendente se guarda
+// corrida ANTI_SHIFT lugares), así que ningún bit se pierde y correrlas al revés es exacto. Los bits
+// de más no molestan porque las columnas libres se filtran con la máscara permitida
+
+const int ANTI_SHIFT = 16;
+
+struct LaneSolver{
+
+    const std::vector<SmallInstance>& instances;
+    std::vector<SmallResult>& results;
+    size_t next_instance = 0;
+
+    lanes_t rem = {}; // Columnas aún por probar en la fila actual
+    lanes_t columns = {};
+    lanes_t diagonals = {};
+    lanes_t anti_diagonals = {}; // Corridas ANTI_SHIFT lugares a la izquierda
+    lanes_t depth = {};
+    lanes_t size = {};
+    lanes_t live = {}; // Todo unos en los carriles con instancia
+
+    size_t lane_instance[LANES];
+    lane_t allowed[MAX_SMALL_N + 1][LANES];
+    lane_t frames[MAX_SMALL_N][LANES]; // Columnas por probar | bit elegido << 16, por fila
+    long long steps = 0;
+
+    LaneSolver(const std::vector<SmallInstance>& batch, std::vector<SmallResult>& batch_results) : instances(batch), results(batch_results){}
+
+    // Carga la siguiente instancia válida en el carril; las inválidas se resuelven sin ocupar carril
+
+    void load(int lane){
+
+        lane_t masks[MAX_SMALL_N + 1];
+
+        while (next_instance < instances.size() && !prepare(instances[next_instance], masks)){
+
+            results[next_instance++].status = INVALID_PLACEMENT;
+
+        }
+
+        if (next_instance == instances.size()){
+
+            live[lane] = 0;
+            rem[lane] = 0;
+            depth[lane] = 0;
+            return;
+
+        }
+
+        for (int row = 0; row <= MAX_SMALL_N; row++){
+
+            allowed[row][lane] = masks[row];
+
+        }
+
+        lane_instance[lane] = next_instance;
+        live[lane] = ~0u;
+        size[lane] = instances[next_instance++].n;
+        depth[lane] = 0;
+        columns[lane] = 0;
+        diagonals[lane] = 0;
+        anti_diagonals[lane] = 0;
+        rem[lane] = masks[0];
+    }
+
+    void finish(int lane, bool solved){
+
+        SmallResult& result = results[lane_instance[lane]];
+        int n = size[lane];
+
+        result.status = solved ? COMPLETED : NO_COMPLETION;
+
+        if (solved){
+
+            result.queens.resize(n);
+
+            for (int row = 0; row < n; row++){
+
+                result.queens[row] = __builtin_ctz(frames[row][lane] >> 16);
+
+            }
+        }
+
+        load(lane);
+    }
+
+    void run(){
+
+        for (int lane = 0; lane < LANES; lane++){
+
+            load(lane);
+
+        }
+
+        while (any_lane(live)){
+
+            steps++;
+
+            lanes_t has = (lanes_t)(rem != 0);
+            lanes_t bit = rem & -rem;
+            lanes_t frame = (rem ^ bit) | (bit << 16);
+
+            lanes_t child_columns = columns | bit;
+            lanes_t child_diagonals = (diagonals | bit) << 1;
+            lanes_t child_anti_diagonals = (anti_diagonals | (bit << ANTI_SHIFT)) >> 1;
+
+            lanes_t next_allowed;
+            lanes_t parent_frame;
+
+            for (int lane = 0; lane < LANES; lane++){
+
+                int row = depth[lane];
+
+                frames[row][lane] = frame[lane];
+                next_allowed[lane] = allowed[row + 1][lane];
+                parent_frame[lane] = frames[row ? row - 1 : 0][lane];
+            }
+
+            lanes_t parent_bit = parent_frame >> 16;
+            lanes_t child_rem = ~(child_columns | child_diagonals | (child_anti_diagonals >> ANTI_SHIFT)) & next_allowed;
+            lanes_t solved = has & (lanes_t)(depth + 1 == size);
+            lanes_t exhausted = ~has & (lanes_t)(depth == 0) & live;
+
+            rem = (has & child_rem) | (~has & (parent_frame & 0xffff));
+            columns = (has & child_columns) | (~has & (columns ^ parent_bit));
+            diagonals = (has & child_diagonals) | (~has & ((diagonals >> 1) ^ parent_bit));
+            anti_diagonals = (has & child_anti_diagonals) | (~has & ((anti_diagonals << 1) ^ (parent_bit << ANTI_SHIFT)));
+            depth += ((has & 2) - 1) & live; // Los carriles sin instancia se quedan en la fila 0
+
+            if (any_lane(solved | exhausted)){
+
+                for (int lane = 0; lane < LANES; lane++){
+
+                    if (solved[lane] || exhausted[lane]){
+
+                        finish(lane, solved[lane]);
+
+                    }
+                }
+            }
+        }
+    }
+};
+
+inline std::vector<SmallResult> solve_lanes(const std::vector<SmallInstance>& instances, long long* steps = nullptr){
+
+    std::vector<SmallResult> results(instances.size());
+    LaneSolver solver(instances, results);
+
+    solver.run();
+
+    if (steps){
+
+        *steps = solver.steps;
+
+    }
+
+    return results;
+}
+
+#endif
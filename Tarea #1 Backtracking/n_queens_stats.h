@@ -0,0 +1,113 @@
+#ifndef N_QUEENS_STATS_H
+#define N_QUEENS_STATS_H
+
+// Contadores de búsqueda para los solvers de backtracking. Se activan compilando con -DNQ_STATS;
+// sin esa bandera SearchStats no tiene datos y todos sus métodos están vacíos, así que el
+// compilador los elimina y los solvers quedan exactamente igual que sin instrumentación.
+//
+// node(fila)      nodo visitado (llamada recursiva en esa fila)
+// branch(fila)    candidato aceptado en esa fila (hijos por fila = ramificación)
+// dead_end(fila)  nodo sin ningún candidato válido
+// backtrack(fila) se deshace una reina al volver de un hijo
+// check()         una prueba de conflicto (casilla del tablero o sameDiagonal())
+// mark(marcar)    llamada a check_box() para marcar o desmarcar
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <chrono>
+
+#ifdef NQ_STATS
+
+struct SearchStats{
+
+    long long nodes = 0;
+    long long dead_ends = 0;
+    long long backtracks = 0;
+    long long checks = 0;
+    long long mark_calls = 0;
+    long long unmark_calls = 0;
+    long long marking_nanoseconds = 0;
+    long long solve_nanoseconds = 0;
+    std::vector<long long> row_nodes; // Nodos visitados en cada fila
+    std::vector<long long> row_branches; // Candidatos aceptados en cada fila
+
+    typedef std::chrono::steady_clock::time_point timestamp;
+
+    void reset(int n){
+
+        *this = SearchStats();
+        row_nodes.assign(n + 1, 0);
+        row_branches.assign(n + 1, 0);
+    }
+
+    void node(int row){ nodes++; row_nodes[row]++; }
+    void branch(int row){ row_branches[row]++; }
+    void dead_end(int){ dead_ends++; }
+    void backtrack(int){ backtracks++; }
+    void check(){ checks++; }
+    void mark(bool marking){ if (marking) mark_calls++; else unmark_calls++; }
+
+    timestamp start_timer() const{ return std::chrono::steady_clock::now(); }
+
+    void stop_marking(timestamp start){
+
+        marking_nanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    }
+
+    void stop_solve(timestamp start){
+
+        solve_nanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    }
+
+    void report(const std::string& name) const{
+
+        std::cout << "[stats] " << name << ": " << nodes << " nodes, " << dead_ends << " dead ends, " << backtracks << " backtracks, "
+                  << checks << " checks, " << mark_calls << " marks, " << unmark_calls << " unmarks" << std::endl;
+        std::cout << "[stats] " << name << ": " << marking_nanoseconds / 1000 << " microseconds marking, "
+                  << (solve_nanoseconds - marking_nanoseconds) / 1000 << " microseconds in the rest of the search" << std::endl;
+    }
+
+    // CSV con una fila por profundidad: nodos, candidatos aceptados y ramificación media
+
+    bool export_csv(const std::string& path) const{
+
+        std::ofstream file(path);
+        file << "row,nodes,branches,branching_factor" << std::endl;
+
+        for (size_t row = 0; row < row_nodes.size(); row++){
+
+            double factor = row_nodes[row] ? static_cast<double>(row_branches[row]) / row_nodes[row] : 0.0;
+            file << row << "," << row_nodes[row] << "," << row_branches[row] << "," << factor << std::endl;
+        }
+
+        return static_cast<bool>(file);
+    }
+};
+
+#else
+
+struct SearchStats{
+
+    typedef int timestamp;
+
+    void reset(int){}
+    void node(int){}
+    void branch(int){}
+    void dead_end(int){}
+    void backtrack(int){}
+    void check(){}
+    void mark(bool){}
+    timestamp start_timer() const{ return 0; }
+    void stop_marking(timestamp){}
+    void stop_solve(timestamp){}
+    void report(const std::string&) const{}
+    bool export_csv(const std::string&) const{ return false; }
+};
+
+#endif
+
+#endif
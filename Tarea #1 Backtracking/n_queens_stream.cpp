@@ -0,0 +1,306 @@
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <iterator>
+using namespace std;
+using namespace std::chrono;
+
+typedef unsigned long long mask_t;
+
+const int MAX_BOARD_SIZE = 32;
+const uint32_t STREAM_MAGIC = 0x4c53514e; // "NQSL"
+const size_t WRITE_BUFFER_SIZE = 1 << 20; // Bytes acumulados antes de cada escritura al archivo
+
+// Generador de soluciones: cada llamada a next() reanuda la búsqueda donde quedó y se detiene en la
+// siguiente solución, que queda en queens (queens[fila] = columna). No se guarda ninguna otra
+// solución, así que la memoria es O(N) sin importar cuántas se recorran. Un tamaño fuera de
+// [1, MAX_BOARD_SIZE] deja valid en false y el generador vacío: next() devuelve false de inmediato
+
+struct SolutionStream{
+
+    int n;
+    int row;
+    mask_t full;
+    bool valid;
+    int queens[MAX_BOARD_SIZE];
+    mask_t candidates[MAX_BOARD_SIZE]; // Columnas libres aún no probadas en cada fila
+    mask_t columns[MAX_BOARD_SIZE];
+    mask_t diagonals[MAX_BOARD_SIZE];
+    mask_t anti_diagonals[MAX_BOARD_SIZE];
+
+    SolutionStream(int size) : n(size), row(0), full(0), valid(size >= 1 && size <= MAX_BOARD_SIZE){
+
+        if (!valid){
+
+            n = 0;
+            row = -1;
+            return;
+
+        }
+
+        full = (1ULL << size) - 1;
+        columns[0] = diagonals[0] = anti_diagonals[0] = 0;
+        candidates[0] = full;
+    }
+
+    bool next(){
+
+        while (row >= 0){
+
+            mask_t free_columns = candidates[row];
+
+            if (!free_columns){
+
+                row--;
+                continue;
+
+            }
+
+            mask_t bit = free_columns & (~free_columns + 1);
+            candidates[row] = free_columns & (free_columns - 1);
+            queens[row] = __builtin_ctzll(bit);
+
+            if (row == n - 1){
+
+                return true; // La fila queda igual: la próxima llamada sigue con la columna siguiente
+
+            }
+
+            columns[row + 1] = columns[row] | bit;
+            diagonals[row + 1] = ((diagonals[row] | bit) << 1) & full;
+            anti_diagonals[row + 1] = (anti_diagonals[row] | bit) >> 1;
+            candidates[row + 1] = ~(columns[row + 1] | diagonals[row + 1] | anti_diagonals[row + 1]) & full;
+            row++;
+        }
+
+        return false;
+    }
+};
+
+int bits_per_column(int n){
+
+    int bits = 1;
+
+    while ((1 << bits) < n){
+
+        bits++;
+
+    }
+
+    return bits;
+}
+
+// Escribe soluciones como un flujo de bits: cada columna ocupa ceil(log2 N) bits, sin relleno entre
+// soluciones. Cabecera: magia, N, bits por columna y cantidad de soluciones (se completa al cerrar)
+
+struct PackedSolutionWriter{
+
+    ofstream file;
+    int n = 0;
+    int bits = 0;
+    vector<unsigned char> buffer;
+    size_t used = 0;
+    uint64_t accumulator = 0; // Bits pendientes que aún no completan un byte
+    int pending_bits = 0;
+    long long written = 0;
+
+    bool open(const string& path, int size){
+
+        file.open(path, ios::binary | ios::trunc);
+        n = size;
+        bits = bits_per_column(size);
+        buffer.resize(WRITE_BUFFER_SIZE);
+        used = 0;
+        accumulator = 0;
+        pending_bits = 0;
+        written = 0;
+
+        uint32_t header[] = {STREAM_MAGIC, static_cast<uint32_t>(n), static_cast<uint32_t>(bits)};
+        file.write(reinterpret_cast<const char*>(header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(&written), sizeof(written));
+
+        return static_cast<bool>(file);
+    }
+
+    void flush(){
+
+        file.write(reinterpret_cast<const char*>(buffer.data()), used);
+        used = 0;
+    }
+
+    void write(const int queens[]){
+
+        for (int row = 0; row < n; row++){
+
+            accumulator |= static_cast<uint64_t>(queens[row]) << pending_bits;
+            pending_bits += bits;
+
+            while (pending_bits >= 8){
+
+                buffer[used++] = static_cast<unsigned char>(accumulator);
+                accumulator >>= 8;
+                pending_bits -= 8;
+            }
+
+            if (used + 8 > buffer.size()){
+
+                flush();
+
+            }
+        }
+
+        written++;
+    }
+
+    bool close(){
+
+        if (pending_bits > 0){
+
+            buffer[used++] = static_cast<unsigned char>(accumulator); // Último byte con relleno en cero
+            pending_bits = 0;
+
+        }
+
+        flush();
+
+        file.seekp(3 * sizeof(uint32_t));
+        file.write(reinterpret_cast<const char*>(&written), sizeof(written));
+        file.close();
+
+        return !file.fail();
+    }
+};
+
+// Lector del formato anterior, usado para comprobar que el archivo se puede recorrer de vuelta
+
+struct PackedSolutionReader{
+
+    int n = 0;
+    int bits = 0;
+    long long count = 0;
+    vector<unsigned char> data;
+    size_t position = 0;
+    uint64_t accumulator = 0;
+    int available_bits = 0;
+
+    bool open(const string& path){
+
+        ifstream file(path, ios::binary);
+        uint32_t header[3];
+
+        file.read(reinterpret_cast<char*>(header), sizeof(header));
+        file.read(reinterpret_cast<char*>(&count), sizeof(count));
+
+        if (!file || header[0] != STREAM_MAGIC){
+
+            return false;
+
+        }
+
+        n = header[1];
+        bits = header[2];
+        data.assign(istreambuf_iterator<char>(file), istreambuf_iterator<char>());
+
+        return true;
+    }
+
+    void read(int queens[]){
+
+        uint64_t column_mask = (1ULL << bits) - 1;
+
+        for (int row = 0; row < n; row++){
+
+            while (available_bits < bits){
+
+                accumulator |= static_cast<uint64_t>(data[position++]) << available_bits;
+                available_bits += 8;
+
+            }
+
+            queens[row] = static_cast<int>(accumulator & column_mask);
+            accumulator >>= bits;
+            available_bits -= bits;
+        }
+    }
+};
+
+int main(){
+
+    const int N = 15;
+    const string PATH = "n_queens_solutions.bin";
+
+    // Solo recorrer el generador
+
+    SolutionStream counting(N);
+    long long solutions = 0;
+
+    auto start = high_resolution_clock::now();
+    while (counting.next()){
+
+        solutions++;
+
+    }
+    auto stop = high_resolution_clock::now();
+    double stream_seconds = duration_cast<microseconds>(stop - start).count() / 1e6;
+
+    // Generador conectado al archivo comprimido
+
+    SolutionStream stream(N);
+    PackedSolutionWriter writer;
+
+    if (!writer.open(PATH, N)){
+
+        cout << "Could not open " << PATH << endl;
+        return 1;
+
+    }
+
+    start = high_resolution_clock::now();
+    while (stream.next()){
+
+        writer.write(stream.queens);
+
+    }
+    bool closed = writer.close();
+    stop = high_resolution_clock::now();
+    double sink_seconds = duration_cast<microseconds>(stop - start).count() / 1e6;
+
+    // Se relee el archivo y se compara con una nueva pasada del generador
+
+    PackedSolutionReader reader;
+    SolutionStream check(N);
+    bool matches = closed && reader.open(PATH) && reader.count == solutions;
+    int decoded[MAX_BOARD_SIZE];
+
+    for (long long i = 0; matches && i < reader.count; i++){
+
+        check.next();
+        reader.read(decoded);
+
+        for (int row = 0; row < N; row++){
+
+            if (decoded[row] != check.queens[row]){
+
+                matches = false;
+
+            }
+        }
+    }
+
+    ifstream size_check(PATH, ios::binary | ios::ate);
+    long long file_bytes = size_check.tellg();
+    size_check.close();
+    remove(PATH.c_str());
+
+    cout << "N = " << N << ": " << solutions << " solutions" << endl;
+    cout << "Stream only: " << stream_seconds << " seconds (" << solutions / stream_seconds << " solutions/second)" << endl;
+    cout << "Stream + packed file: " << sink_seconds << " seconds (" << solutions / sink_seconds << " solutions/second), "
+         << file_bytes << " bytes (" << bits_per_column(N) << " bits per column)" << endl;
+    cout << "Read back: " << (matches ? "matches" : "MISMATCH") << endl;
+
+    return 0;
+}
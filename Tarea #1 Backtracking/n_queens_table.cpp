@@ -0,0 +1,138 @@
+#include <iostream>
+#include <chrono>
+#include <array>
+#include <random>
+#include <utility>
+#include <vector>
+#include "n_queens_count.h"
+#include "n_queens_row.h"
+#include "n_queens_table.h"
+#include "n_queens_verify.h"
+using namespace std;
+using namespace std::chrono;
+
+const int SELF_CHECK_MAX_N = 12; // Conteos que se recalculan al arrancar
+
+// Verificación al arrancar: todas las primeras soluciones de la tabla deben ser válidas, una muestra
+// debe coincidir con el solver en vivo y los conteos pequeños se recalculan
+
+bool self_check(mt19937& rng){
+
+    const int SAMPLES = 4;
+    const int MAX_SAMPLED_N = TABLE_MAX_N;
+
+    for (int n = 1; n <= TABLE_MAX_N; n++){
+
+        vector<int> queens;
+
+        if (first_solution(n, queens) != (KNOWN_SOLUTIONS[n] > 0) || (KNOWN_SOLUTIONS[n] > 0 && !valid_solution(queens))){
+
+            return false;
+
+        }
+    }
+
+    uniform_int_distribution<int> sampled_n(4, MAX_SAMPLED_N);
+
+    for (int sample = 0; sample < SAMPLES; sample++){
+
+        int n = sampled_n(rng);
+        vector<int> table_queens;
+        vector<int> live_queens(n);
+
+        first_solution(n, table_queens);
+        live_first_solution(n, live_queens);
+
+        if (table_queens != live_queens){
+
+            return false;
+
+        }
+    }
+
+    for (int n = 0; n <= SELF_CHECK_MAX_N; n++){
+
+        if (count_solutions(0, n, full_mask(n), 0, 0, 0) != KNOWN_SOLUTIONS[n]){
+
+            return false;
+
+        }
+    }
+
+    return true;
+}
+
+int main(){
+
+    mt19937 rng(random_device{}());
+
+    auto start = high_resolution_clock::now();
+    bool table_ok = self_check(rng);
+    auto stop = high_resolution_clock::now();
+
+    cout << "Self-check: " << (table_ok ? "ok" : "FAILED") << " (" << duration_cast<microseconds>(stop - start).count() << " microseconds)" << endl;
+
+    if (!table_ok){
+
+        return 1;
+
+    }
+
+    // Consultas a la tabla
+
+    const int LOOKUPS = 10000000;
+    uniform_int_distribution<int> table_n(1, TABLE_MAX_N);
+    vector<int> sizes(LOOKUPS);
+    vector<int> queens;
+    long long checksum = 0;
+
+    for (int& n : sizes){
+
+        n = table_n(rng);
+
+    }
+
+    start = high_resolution_clock::now();
+    for (int n : sizes){
+
+        checksum += solution_count(n);
+
+    }
+    stop = high_resolution_clock::now();
+    double count_nanoseconds = static_cast<double>(duration_cast<nanoseconds>(stop - start).count()) / LOOKUPS;
+
+    start = high_resolution_clock::now();
+    for (int n : sizes){
+
+        if (first_solution(n, queens)) checksum += queens[0];
+
+    }
+    stop = high_resolution_clock::now();
+    double solution_nanoseconds = static_cast<double>(duration_cast<nanoseconds>(stop - start).count()) / LOOKUPS;
+
+    cout << "Table lookups (checksum " << checksum << "): count " << count_nanoseconds << " ns, first solution " << solution_nanoseconds << " ns" << endl;
+
+    // Comparación con el solver en vivo para algunos N
+
+    for (int n : {12, 20, 22, 27}){
+
+        vector<int> live_queens(n);
+
+        start = high_resolution_clock::now();
+        live_first_solution(n, live_queens);
+        stop = high_resolution_clock::now();
+
+        cout << "Live first solution N = " << n << ": " << duration_cast<microseconds>(stop - start).count() << " microseconds" << endl;
+    }
+
+    // N fuera de la tabla: pasa al solver en vivo
+
+    start = high_resolution_clock::now();
+    bool found = first_solution(30, queens);
+    stop = high_resolution_clock::now();
+
+    cout << "First solution N = 30 (live): " << (found && valid_solution(queens) ? "valid" : "INVALID") << " in "
+         << duration_cast<microseconds>(stop - start).count() << " microseconds" << endl;
+
+    return 0;
+}
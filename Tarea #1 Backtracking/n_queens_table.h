@@ -0,0 +1,190 @@
+#ifndef N_QUEENS_TABLE_H
+#define N_QUEENS_TABLE_H
+
+// Tabla de primeras soluciones y conteos de n_queens_table.cpp, con el solver de máscaras de
+// n_queens_row.h para los N que no cubre. Lo usan n_queens_table.cpp y n_queens_benchmark.cpp
+
+#include <array>
+#include <utility>
+#include <vector>
+#include "n_queens_count.h"
+#include "n_queens_row.h"
+
+const int TABLE_MAX_N = 27;
+const int CONSTEXPR_MAX_N = 20; // Primeras soluciones que calcula el compilador; el resto son literales
+
+// Los conteos de la tabla son KNOWN_SOLUTIONS de n_queens_count.h (OEIS A000170)
+
+static_assert(KNOWN_SOLUTIONS_SIZE > TABLE_MAX_N, "KNOWN_SOLUTIONS debe cubrir N = 0..TABLE_MAX_N");
+
+// Primera solución en el mismo orden que backtracking() (columnas de menor a mayor, fila por fila).
+// Hasta CONSTEXPR_MAX_N la calcula el compilador, cada N como una expresión constante aparte (unos
+// 260 mil nodos en total, un par de segundos de compilación). Desde N = 21 la búsqueda pasa el límite
+// de operaciones por expresión constante de GCC (N = 22 necesita 1.7 millones de nodos), así que esas
+// filas son literales generados con live_first_solution(); un static_assert comprueba que sean
+// soluciones válidas y self_check() las compara con el solver en vivo
+
+typedef std::array<unsigned char, TABLE_MAX_N> TableRow; // Columna de cada fila; cabe en un byte
+
+constexpr bool constexpr_search(int row, int n, mask_t full, mask_t columns, mask_t diagonals, mask_t anti_diagonals, TableRow& queens){
+
+    if (row == n){
+
+        return true;
+
+    }
+
+    mask_t free_columns = ~(columns | diagonals | anti_diagonals) & full;
+
+    while (free_columns){
+
+        mask_t bit = free_columns & (~free_columns + 1);
+        queens[row] = static_cast<unsigned char>(__builtin_ctzll(bit));
+
+        if (constexpr_search(row + 1, n, full, columns | bit, ((diagonals | bit) << 1) & full, (anti_diagonals | bit) >> 1, queens)){
+
+            return true;
+
+        }
+
+        free_columns &= free_columns - 1;
+    }
+
+    return false;
+}
+
+template <int N>
+struct FirstSolution{
+
+    static constexpr TableRow make(){
+
+        TableRow queens{};
+        constexpr_search(0, N, (1ULL << N) - 1, 0, 0, 0, queens);
+        return queens;
+    }
+
+    static constexpr TableRow value = make();
+};
+
+constexpr TableRow LITERAL_FIRST_SOLUTIONS[TABLE_MAX_N - CONSTEXPR_MAX_N] = {
+    {{0, 2, 4, 1, 3, 8, 10, 14, 20, 17, 19, 16, 18, 6, 11, 9, 7, 5, 13, 15, 12}},
+    {{0, 2, 4, 1, 3, 9, 13, 16, 19, 12, 18, 21, 17, 7, 20, 11, 8, 5, 15, 6, 10, 14}},
+    {{0, 2, 4, 1, 3, 8, 10, 12, 17, 19, 21, 18, 20, 9, 7, 5, 22, 6, 15, 11, 14, 16, 13}},
+    {{0, 2, 4, 1, 3, 8, 10, 13, 17, 21, 18, 22, 19, 23, 9, 20, 5, 7, 11, 15, 12, 6, 16, 14}},
+    {{0, 2, 4, 1, 3, 8, 10, 12, 14, 18, 20, 23, 19, 24, 22, 5, 7, 9, 6, 13, 15, 17, 11, 16, 21}},
+    {{0, 2, 4, 1, 3, 8, 10, 12, 14, 20, 22, 24, 19, 21, 23, 25, 9, 6, 15, 11, 7, 5, 17, 13, 18, 16}},
+    {{0, 2, 4, 1, 3, 8, 10, 12, 14, 16, 18, 22, 24, 26, 23, 25, 5, 9, 6, 15, 7, 11, 13, 20, 17, 19, 21}}
+};
+
+template <int N>
+constexpr TableRow table_row(){
+
+    if constexpr (N <= CONSTEXPR_MAX_N){
+
+        return FirstSolution<N>::value;
+
+    } else{
+
+        return LITERAL_FIRST_SOLUTIONS[N - CONSTEXPR_MAX_N - 1];
+
+    }
+}
+
+template <int... Sizes>
+constexpr std::array<TableRow, sizeof...(Sizes)> make_first_solutions(std::integer_sequence<int, Sizes...>){
+
+    return {{table_row<Sizes>()...}};
+
+}
+
+constexpr std::array<TableRow, TABLE_MAX_N + 1> FIRST_SOLUTIONS = make_first_solutions(std::make_integer_sequence<int, TABLE_MAX_N + 1>{});
+
+// Comprobación en tiempo de compilación: ninguna pareja de reinas de la tabla se ataca
+
+constexpr bool table_is_valid(){
+
+    for (int n = 4; n <= TABLE_MAX_N; n++){
+
+        for (int row = 0; row < n; row++){
+
+            for (int other = row + 1; other < n; other++){
+
+                int distance = FIRST_SOLUTIONS[n][other] - FIRST_SOLUTIONS[n][row];
+
+                if (distance == 0 || distance == other - row || distance == row - other){
+
+                    return false;
+
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+static_assert(table_is_valid(), "La tabla de primeras soluciones tiene reinas que se atacan");
+static_assert(FIRST_SOLUTIONS[8][0] == 0 && FIRST_SOLUTIONS[8][1] == 4 && FIRST_SOLUTIONS[8][7] == 3, "Primera solución de N = 8: 0 4 7 5 2 6 1 3");
+
+// Solver en vivo para los N que no están en la tabla (y para la verificación al arrancar): el motor
+// de máscaras de n_queens_row.h, que sigue el mismo orden que la tabla
+
+inline bool live_first_solution(int n, std::vector<int>& queens){
+
+    BitmaskSolver solver(n);
+    solver.bitmask_backtracking(0, 0, 0, 0);
+    queens = solver.queen_column;
+
+    return solver.solution_found;
+}
+
+// API de consulta: la tabla responde para N <= TABLE_MAX_N y el resto pasa al solver en vivo
+
+inline bool first_solution(int n, std::vector<int>& queens){
+
+    if (n < 1 || n > MAX_MASK_SIZE){
+
+        return false;
+
+    }
+
+    queens.resize(n);
+
+    if (n <= TABLE_MAX_N){
+
+        if (KNOWN_SOLUTIONS[n] == 0){
+
+            return false;
+
+        }
+
+        for (int row = 0; row < n; row++){
+
+            queens[row] = FIRST_SOLUTIONS[n][row];
+
+        }
+
+        return true;
+    }
+
+    return live_first_solution(n, queens);
+}
+
+inline long long solution_count(int n){
+
+    if (n < 0 || n > MAX_MASK_SIZE){
+
+        return -1;
+
+    }
+
+    if (n <= TABLE_MAX_N){
+
+        return KNOWN_SOLUTIONS[n];
+
+    }
+
+    return count_solutions(0, n, full_mask(n), 0, 0, 0); // Para N > 27 esto tarda años; se deja por completitud
+}
+
+#endif
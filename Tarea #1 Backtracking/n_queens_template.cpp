@@ -0,0 +1,73 @@
+#include <iostream>
+#include <chrono>
+#include "n_queens_template.h"
+using namespace std;
+using namespace std::chrono;
+
+int main(){
+
+    const int ITERATIONS = 20;
+    const int MAX_FIRST_SOLUTION_N = 27;
+    const int MIN_COUNT_N = 8;
+    const int MAX_COUNT_N = 13;
+    int queens[MAX_FIXED_N];
+
+    // Primera solución para todos los N del rango
+
+    long long runtime_nanoseconds = 0;
+    long long fixed_nanoseconds = 0;
+
+    for (int iteration = 0; iteration < ITERATIONS; iteration++){
+
+        for (int n = MIN_FIXED_N; n <= MAX_FIRST_SOLUTION_N; n++){
+
+            RuntimeSolver runtime_solver(n);
+
+            auto start = high_resolution_clock::now();
+            runtime_solver.search(0, 0, 0, 0);
+            auto middle = high_resolution_clock::now();
+            solve_specialized(n, queens);
+            auto stop = high_resolution_clock::now();
+
+            runtime_nanoseconds += duration_cast<nanoseconds>(middle - start).count();
+            fixed_nanoseconds += duration_cast<nanoseconds>(stop - middle).count();
+
+            for (int row = 0; row < n; row++){
+
+                if (queens[row] != runtime_solver.queens[row]){
+
+                    cout << "Different first solution for N = " << n << endl;
+                    return 1;
+
+                }
+            }
+        }
+    }
+
+    cout << "First solution, N = " << MIN_FIXED_N << ".." << MAX_FIRST_SOLUTION_N << " (" << ITERATIONS << " iterations)" << endl;
+    cout << "  Runtime N: " << runtime_nanoseconds / 1000 << " microseconds" << endl;
+    cout << "  Specialized N: " << fixed_nanoseconds / 1000 << " microseconds (speedup "
+         << static_cast<double>(runtime_nanoseconds) / fixed_nanoseconds << "x)" << endl;
+
+    // Conteo completo, donde el árbol es mucho más grande
+
+    for (int n = MIN_COUNT_N; n <= MAX_COUNT_N; n++){
+
+        RuntimeSolver runtime_solver(n);
+
+        auto start = high_resolution_clock::now();
+        long long runtime_count = runtime_solver.count(0, 0, 0, 0);
+        auto middle = high_resolution_clock::now();
+        long long fixed_count = count_specialized(n);
+        auto stop = high_resolution_clock::now();
+
+        auto runtime_duration = duration_cast<microseconds>(middle - start).count();
+        auto fixed_duration = duration_cast<microseconds>(stop - middle).count();
+
+        cout << "Count N = " << n << ": " << fixed_count << (fixed_count == runtime_count ? "" : " (MISMATCH)")
+             << ", runtime " << runtime_duration << " microseconds, specialized " << fixed_duration << " microseconds (speedup "
+             << static_cast<double>(runtime_duration) / max(1LL, static_cast<long long>(fixed_duration)) << "x)" << endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,234 @@
+#ifndef N_QUEENS_TEMPLATE_H
+#define N_QUEENS_TEMPLATE_H
+
+// Solver por máscaras con N como parámetro de plantilla (n_queens_template.cpp) y su versión con N
+// en tiempo de ejecución. Los usan n_queens_template.cpp y n_queens_benchmark.cpp
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+const int MIN_FIXED_N = 4;
+const int MAX_FIXED_N = 64;
+
+// Solver genérico: N se conoce solo en tiempo de ejecución, así que la máscara siempre es de 64 bits
+// y los límites se leen de los parámetros
+
+struct RuntimeSolver{
+
+    int n;
+    uint64_t full;
+    int queens[MAX_FIXED_N];
+
+    RuntimeSolver(int size) : n(size), full(size == 64 ? ~0ULL : (1ULL << size) - 1){}
+
+    bool search(int row, uint64_t columns, uint64_t diagonals, uint64_t anti_diagonals){
+
+        if (row == n){
+
+            return true;
+
+        }
+
+        uint64_t free_columns = ~(columns | diagonals | anti_diagonals) & full;
+
+        while (free_columns){
+
+            uint64_t bit = free_columns & (~free_columns + 1);
+
+            queens[row] = __builtin_ctzll(bit);
+
+            if (search(row + 1, columns | bit, ((diagonals | bit) << 1) & full, (anti_diagonals | bit) >> 1)){
+
+                return true;
+
+            }
+
+            free_columns &= free_columns - 1;
+        }
+
+        return false;
+    }
+
+    long long count(int row, uint64_t columns, uint64_t diagonals, uint64_t anti_diagonals){
+
+        if (row == n){
+
+            return 1;
+
+        }
+
+        long long total = 0;
+        uint64_t free_columns = ~(columns | diagonals | anti_diagonals) & full;
+
+        while (free_columns){
+
+            uint64_t bit = free_columns & (~free_columns + 1);
+
+            total += count(row + 1, columns | bit, ((diagonals | bit) << 1) & full, (anti_diagonals | bit) >> 1);
+
+            free_columns &= free_columns - 1;
+        }
+
+        return total;
+    }
+};
+
+// Solver especializado: N es un parámetro de la plantilla, así que el ancho de la máscara (32 o 64
+// bits), la máscara completa y la condición de parada son constantes de compilación
+
+template <int N>
+struct FixedSolver{
+
+    typedef std::conditional_t<(N <= 32), uint32_t, uint64_t> mask_type;
+
+    static constexpr int MASK_BITS = 8 * sizeof(mask_type);
+    static constexpr mask_type FULL = (N == MASK_BITS) ? ~mask_type(0) : ((mask_type(1) << (N % MASK_BITS)) - 1);
+
+    int queens[N];
+
+    bool search(int row, mask_type columns, mask_type diagonals, mask_type anti_diagonals){
+
+        if (row == N){
+
+            return true;
+
+        }
+
+        mask_type free_columns = ~(columns | diagonals | anti_diagonals) & FULL;
+
+        while (free_columns){
+
+            mask_type bit = free_columns & (~free_columns + 1);
+
+            queens[row] = __builtin_ctzll(bit);
+
+            if (search(row + 1, columns | bit, static_cast<mask_type>((diagonals | bit) << 1) & FULL, (anti_diagonals | bit) >> 1)){
+
+                return true;
+
+            }
+
+            free_columns &= free_columns - 1;
+        }
+
+        return false;
+    }
+
+    long long count(int row, mask_type columns, mask_type diagonals, mask_type anti_diagonals){
+
+        if (row == N){
+
+            return 1;
+
+        }
+
+        long long total = 0;
+        mask_type free_columns = ~(columns | diagonals | anti_diagonals) & FULL;
+
+        while (free_columns){
+
+            mask_type bit = free_columns & (~free_columns + 1);
+
+            total += count(row + 1, columns | bit, static_cast<mask_type>((diagonals | bit) << 1) & FULL, (anti_diagonals | bit) >> 1);
+
+            free_columns &= free_columns - 1;
+        }
+
+        return total;
+    }
+};
+
+typedef bool (*SolveFunction)(int queens[]);
+typedef long long (*CountFunction)();
+
+template <int N>
+bool solve_fixed(int queens[]){
+
+    FixedSolver<N> solver;
+    bool found = solver.search(0, 0, 0, 0);
+
+    for (int row = 0; found && row < N; row++){
+
+        queens[row] = solver.queens[row];
+
+    }
+
+    return found;
+}
+
+template <int N>
+long long count_fixed(){
+
+    FixedSolver<N> solver;
+    return solver.count(0, 0, 0, 0);
+
+}
+
+// Tablas de despacho: la posición i guarda la instancia para N = MIN_FIXED_N + i
+
+template <int... Offsets>
+constexpr std::array<SolveFunction, sizeof...(Offsets)> make_solve_table(std::integer_sequence<int, Offsets...>){
+
+    return {{&solve_fixed<MIN_FIXED_N + Offsets>...}};
+
+}
+
+template <int... Offsets>
+constexpr std::array<CountFunction, sizeof...(Offsets)> make_count_table(std::integer_sequence<int, Offsets...>){
+
+    return {{&count_fixed<MIN_FIXED_N + Offsets>...}};
+
+}
+
+constexpr auto SOLVE_TABLE = make_solve_table(std::make_integer_sequence<int, MAX_FIXED_N - MIN_FIXED_N + 1>{});
+constexpr auto COUNT_TABLE = make_count_table(std::make_integer_sequence<int, MAX_FIXED_N - MIN_FIXED_N + 1>{});
+
+// Punto de entrada para cualquier N: usa la versión especializada si existe y si no la genérica
+
+inline bool solve_specialized(int n, int queens[]){
+
+    if (n >= MIN_FIXED_N && n <= MAX_FIXED_N){
+
+        return SOLVE_TABLE[n - MIN_FIXED_N](queens);
+
+    }
+
+    if (n < 1 || n > MAX_FIXED_N){
+
+        return false;
+
+    }
+
+    RuntimeSolver solver(n);
+    bool found = solver.search(0, 0, 0, 0);
+
+    for (int row = 0; found && row < n; row++){
+
+        queens[row] = solver.queens[row];
+
+    }
+
+    return found;
+}
+
+inline long long count_specialized(int n){
+
+    if (n >= MIN_FIXED_N && n <= MAX_FIXED_N){
+
+        return COUNT_TABLE[n - MIN_FIXED_N]();
+
+    }
+
+    if (n < 1 || n > MAX_FIXED_N){
+
+        return 0;
+
+    }
+
+    RuntimeSolver solver(n);
+    return solver.count(0, 0, 0, 0);
+}
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef N_QUEENS_VERIFY_H
+#define N_QUEENS_VERIFY_H
+
+// Comprobación de soluciones en la representación de los motores por filas (queens[fila] = columna).
+// La usan los programas que validan lo que devuelve cada motor y n_queens_benchmark.cpp
+
+#include <vector>
+
+// true si hay una reina por fila, todas dentro del tablero y ningún par comparte columna o diagonal
+
+inline bool valid_solution(const std::vector<int>& queens){
+
+    int n = queens.size();
+    std::vector<bool> columns(n, false);
+    std::vector<bool> diagonals(2 * n - 1, false);
+    std::vector<bool> anti_diagonals(2 * n - 1, false);
+
+    for (int row = 0; row < n; row++){
+
+        int column = queens[row];
+
+        if (column < 0 || column >= n || columns[column] || diagonals[row + column] || anti_diagonals[row - column + n - 1]){
+
+            return false;
+
+        }
+
+        columns[column] = true;
+        diagonals[row + column] = true;
+        anti_diagonals[row - column + n - 1] = true;
+    }
+
+    return true;
+}
+
+#endif
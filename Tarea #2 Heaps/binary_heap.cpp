@@ -3,6 +3,11 @@
 #include <ctime>
 #include <chrono>
 #include <random>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <algorithm>
 
 using namespace std;
 using namespace std::chrono;
@@ -70,6 +75,168 @@ int getMin(const vector<int>& heap){
 
 }
 
+// Versión genérica: heap binario sobre cualquier tipo, comparador y contenedor de acceso aleatorio
+// (vector por defecto). compare(a, b) == true significa que a debe salir antes que b, así que con
+// less<T> es un heap de mínimos como el de arriba (al revés que priority_queue). Los elementos
+// nunca se copian: las operaciones de flotar y hundir mueven un "hueco" por el árbol y el valor se
+// mueve una sola vez a su lugar final, así que sirve para tipos que solo se pueden mover
+
+template <typename T, typename Compare = less<T>, typename Container = vector<T>>
+class BinaryHeap{
+
+public:
+
+    typedef typename Container::size_type size_type;
+
+    BinaryHeap(const Compare& comparator = Compare()) : compare(comparator){}
+
+    bool empty() const{ return data.empty(); }
+    size_type size() const{ return data.size(); }
+    const T& top() const{ return data.front(); }
+
+    void push(const T& value){
+
+        data.push_back(value);
+        floatUp(data.size() - 1);
+
+    }
+
+    void push(T&& value){
+
+        data.push_back(std::move(value));
+        floatUp(data.size() - 1);
+
+    }
+
+    // Construye el elemento directamente al final del contenedor
+
+    template <typename... Args>
+    void emplace(Args&&... args){
+
+        data.emplace_back(std::forward<Args>(args)...);
+        floatUp(data.size() - 1);
+
+    }
+
+    // Inserta [first, last) de una vez (con make_move_iterator los elementos se mueven). Si el rango
+    // es más grande que el heap actual sale más barato reconstruirlo entero en O(n) que flotar cada
+    // elemento nuevo
+
+    template <typename InputIt>
+    void pushRange(InputIt first, InputIt last){
+
+        size_type old_size = data.size();
+        data.insert(data.end(), first, last);
+
+        if (data.size() - old_size > old_size){
+
+            heapify();
+
+        } else{
+
+            for (size_type i = old_size; i < data.size(); i++){
+
+                floatUp(i);
+
+            }
+        }
+    }
+
+    // Saca el elemento de mayor prioridad moviéndolo a out
+
+    void popInto(T& out){
+
+        out = std::move(data.front());
+        pop();
+
+    }
+
+    // Saca el elemento de mayor prioridad sin devolverlo
+
+    void pop(){
+
+        if (data.size() > 1){
+
+            T last = std::move(data.back());
+            data.pop_back();
+            sinkDown(0, std::move(last));
+
+        } else{
+
+            data.pop_back();
+
+        }
+    }
+
+private:
+
+    Container data;
+    Compare compare;
+
+    // El elemento de index sube mientras tenga más prioridad que su padre; los padres bajan al hueco.
+    // Con datos al azar la mayoría de las inserciones no sube ni un nivel, así que primero se compara
+    // con el padre y solo se abre el hueco si hace falta
+
+    void floatUp(size_type index){
+
+        if (index == 0 || !compare(data[index], data[(index - 1) / 2])){
+
+            return;
+
+        }
+
+        T value = std::move(data[index]);
+
+        do{
+
+            size_type parent = (index - 1) / 2;
+            data[index] = std::move(data[parent]);
+            index = parent;
+
+        } while (index > 0 && compare(value, data[(index - 1) / 2]));
+
+        data[index] = std::move(value);
+    }
+
+    // Hunde value desde el hueco index: el hijo de más prioridad sube mientras le gane a value
+
+    void sinkDown(size_type index, T value){
+
+        size_type size = data.size();
+        size_type child = 2 * index + 1;
+
+        while (child < size){
+
+            if (child + 1 < size && compare(data[child + 1], data[child])){
+
+                child++;
+
+            }
+
+            if (!compare(data[child], value)){
+
+                break;
+
+            }
+
+            data[index] = std::move(data[child]);
+            index = child;
+            child = 2 * index + 1;
+        }
+
+        data[index] = std::move(value);
+    }
+
+    void heapify(){
+
+        for (size_type i = data.size() / 2; i-- > 0;){
+
+            sinkDown(i, std::move(data[i]));
+
+        }
+    }
+};
+
 void experiment(const unsigned long long N, unsigned seed){
 
     vector<int> heap;
@@ -121,6 +288,105 @@ void experiment(const unsigned long long N, unsigned seed){
     cout << "Tiempo inserciones: " << duration_insert.count() << " microsegundos" << endl;
     cout << "Tiempo consultas minimo: " << duration_getMin.count() << " microsegundos" << endl;
     cout << "Tiempo extracciones minimo: " << duration_extract.count() << " microsegundos" << endl;
+
+    // Mismas operaciones y mismos números con el heap genérico
+
+    BinaryHeap<int> generic_heap;
+    gen.seed(seed);
+    dist.reset();
+    long long checksum = 0;
+
+    start_insert = high_resolution_clock::now();
+    for (unsigned long long i = 0; i < N; ++i) {
+        generic_heap.push(dist(gen));
+    }
+    end_insert = high_resolution_clock::now();
+    duration_insert = duration_cast<microseconds>(end_insert - start_insert);
+
+    start_getMin = high_resolution_clock::now();
+    for (unsigned long long i = 0; i < N; ++i){
+        checksum += generic_heap.top();
+    }
+    end_getMin = high_resolution_clock::now();
+    duration_getMin = duration_cast<microseconds>(end_getMin - start_getMin);
+
+    bool sorted_output = true;
+    int previous = 0;
+
+    start_extract = high_resolution_clock::now();
+    for (unsigned long long i = 0; i < N; ++i) {
+        if (!generic_heap.empty()){
+            int value;
+            generic_heap.popInto(value);
+            sorted_output = sorted_output && previous <= value;
+            previous = value;
+        }
+    }
+    end_extract = high_resolution_clock::now();
+    duration_extract = duration_cast<microseconds>(end_extract - start_extract);
+
+    cout << "Heap generico (BinaryHeap<int>):" << endl;
+    cout << "Tiempo inserciones: " << duration_insert.count() << " microsegundos" << endl;
+    cout << "Tiempo consultas minimo: " << duration_getMin.count() << " microsegundos (suma " << checksum << ")" << endl;
+    cout << "Tiempo extracciones minimo: " << duration_extract.count() << " microsegundos" << endl;
+    cout << "Extracciones en orden: " << (sorted_output ? "si" : "no") << endl;
+    cout << "----------------------------------" << endl;
+}
+
+// Tareas que solo se pueden mover (el unique_ptr no tiene copia), con comparador propio: sale primero
+// la de mayor prioridad. Se insertan con emplace y pushRange y se sacan con popInto
+
+struct Task{
+
+    int priority;
+    unique_ptr<vector<int>> payload;
+
+};
+
+struct HigherPriority{
+
+    bool operator()(const Task& a, const Task& b) const{ return a.priority > b.priority; }
+
+};
+
+void experimentTasks(const unsigned long long N, unsigned seed){
+
+    mt19937 gen(seed);
+    uniform_int_distribution<int> dist(1, 1000000);
+    BinaryHeap<Task, HigherPriority> tasks;
+    vector<Task> batch;
+
+    for (unsigned long long i = 0; i < N / 2; ++i) {
+        batch.push_back({dist(gen), make_unique<vector<int>>(1, i)});
+    }
+
+    auto start_insert = high_resolution_clock::now();
+    tasks.pushRange(make_move_iterator(batch.begin()), make_move_iterator(batch.end()));
+    for (unsigned long long i = N / 2; i < N; ++i) {
+        tasks.emplace(Task{dist(gen), make_unique<vector<int>>(1, i)});
+    }
+    auto end_insert = high_resolution_clock::now();
+    auto duration_insert = duration_cast<microseconds>(end_insert - start_insert);
+
+    bool sorted_output = true;
+    int previous = 1000001;
+    long long payloads = 0;
+    Task task;
+
+    auto start_extract = high_resolution_clock::now();
+    while (!tasks.empty()) {
+        tasks.popInto(task);
+        sorted_output = sorted_output && task.priority <= previous && task.payload;
+        previous = task.priority;
+        payloads++;
+    }
+    auto end_extract = high_resolution_clock::now();
+    auto duration_extract = duration_cast<microseconds>(end_extract - start_extract);
+
+    cout << "Tareas move-only (N = " << N << ")" << endl;
+    cout << "Tiempo inserciones (pushRange + emplace): " << duration_insert.count() << " microsegundos" << endl;
+    cout << "Tiempo extracciones maximo: " << duration_extract.count() << " microsegundos" << endl;
+    cout << "Tareas extraidas: " << payloads << ", en orden y con payload: " << (sorted_output ? "si" : "no") << endl;
     cout << "----------------------------------" << endl;
 }
 
@@ -132,6 +398,7 @@ int main(){
     // aleatorios en los tres heaps.
 
     experiment(N, seed);
+    experimentTasks(N / 10, seed);
 
     return 0;
 }
\ No newline at end of file